@@ -0,0 +1,108 @@
+#[[ Measures how much the free operators of units cost the overload resolution of unrelated types.
+
+    Invoked as:
+        cmake -DCOMPILER=<c++ compiler> -DINCLUDE_DIR=<include dir> -DWORK_DIR=<scratch dir>
+              [-DSTANDARD=<c++17 by default>] [-DRUNS=<5 by default>]
+              [-DFOREIGN_COUNT=<4000 by default>] [-DMIXED_COUNT=<1500 by default>]
+              -P overloadResolutionBenchmark.cmake
+
+    Two translation units are generated and parsed RUNS times each with -fsyntax-only:
+
+    - foreignOperators.cpp defines FOREIGN_COUNT functions inside namespace units that apply the
+      operators of std::string and std::complex<double>. Every one of those expressions considers
+      the operator templates of units, so this is where unconstrained operators show.
+    - mixedOperators.cpp defines MIXED_COUNT functions each of std::complex<double>,
+      std::chrono and units arithmetic under 'using namespace units'.
+
+    Point INCLUDE_DIR at a checkout of another revision to compare, e.g. the parent of the commit
+    that constrained the operators to AffineQuantity:
+        git worktree add /tmp/before <revision>
+        cmake ... -DINCLUDE_DIR=/tmp/before/include ... ]]
+
+foreach(argument COMPILER INCLUDE_DIR WORK_DIR)
+    if(NOT DEFINED ${argument})
+        message(FATAL_ERROR "overloadResolutionBenchmark.cmake requires -D${argument}=<value>.")
+    endif()
+endforeach()
+
+if(NOT DEFINED STANDARD)
+    set(STANDARD c++17)
+endif()
+
+if(NOT DEFINED RUNS)
+    set(RUNS 5)
+endif()
+
+if(NOT DEFINED FOREIGN_COUNT)
+    set(FOREIGN_COUNT 4000)
+endif()
+
+if(NOT DEFINED MIXED_COUNT)
+    set(MIXED_COUNT 1500)
+endif()
+
+file(MAKE_DIRECTORY "${WORK_DIR}")
+
+set(foreign "#include <complex>\n#include <string>\n#include <units/si.hpp>\n\n")
+string(APPEND foreign "namespace units\n{\n")
+foreach(index RANGE 1 ${FOREIGN_COUNT})
+    string(APPEND foreign
+           "std::string s${index}(const std::string& a, const std::string& b) "
+           "{ return a + b + \"x\" + a; }\n"
+           "bool q${index}(std::complex<double> a, std::complex<double> b) "
+           "{ return a * b - a / b == b + a; }\n")
+endforeach()
+string(APPEND foreign "} // End of namespace units.\n")
+file(WRITE "${WORK_DIR}/foreignOperators.cpp" "${foreign}")
+
+set(mixed "#include <chrono>\n#include <complex>\n#include <units/imperial.hpp>\n")
+string(APPEND mixed "#include <units/si.hpp>\n\nusing namespace units;\n\n")
+foreach(index RANGE 1 ${MIXED_COUNT})
+    string(APPEND mixed
+           "std::complex<double> c${index}(std::complex<double> a, std::complex<double> b) "
+           "{ return a * b + a / b - a; }\n"
+           "bool d${index}(std::chrono::nanoseconds a, std::chrono::milliseconds b) "
+           "{ return a + b < b - a and a == b; }\n"
+           "double u${index}(Metres a, Inches b) "
+           "{ return (a * b).scalar() + (a + b).scalar() + (a < b); }\n")
+endforeach()
+file(WRITE "${WORK_DIR}/mixedOperators.cpp" "${mixed}")
+
+set(failed FALSE)
+
+foreach(unit foreignOperators mixedOperators)
+    set(timings "")
+    set(fastest "")
+
+    foreach(run RANGE 1 ${RUNS})
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND "${COMPILER}" -std=${STANDARD} -O0 -fsyntax-only "-I${INCLUDE_DIR}"
+                    "${WORK_DIR}/${unit}.cpp"
+            RESULT_VARIABLE result
+            ERROR_VARIABLE errors)
+        string(TIMESTAMP stop "%s%f")
+
+        if(NOT result EQUAL 0)
+            string(SUBSTRING "${errors}" 0 2000 errors)
+            message(WARNING "${unit}.cpp does not compile against ${INCLUDE_DIR}:\n${errors}")
+            set(failed TRUE)
+            break()
+        endif()
+
+        math(EXPR milliseconds "(${stop} - ${start}) / 1000")
+        list(APPEND timings ${milliseconds})
+
+        if(fastest STREQUAL "" OR milliseconds LESS fastest)
+            set(fastest ${milliseconds})
+        endif()
+    endforeach()
+
+    if(failed)
+        message(STATUS "${unit}: does not compile.")
+        set(failed FALSE)
+    else()
+        list(JOIN timings " " timings)
+        message(STATUS "${unit}: fastest ${fastest} ms of ${RUNS} runs (${timings} ms).")
+    endif()
+endforeach()
@@ -0,0 +1,136 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <cstdio>
+#include <units/imperial.hpp>
+#include <units/pmr.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+/// Compares std::vector against arena-backed pmr containers on a request-shaped workload: every
+/// request fills a few short-lived quantity columns, derives new columns from them and discards
+/// everything at the end.
+
+namespace
+{
+
+constexpr std::size_t kRequests = 20000U;
+constexpr std::size_t kSamples = 256U;
+
+template<typename Function>
+double timeRequests(Function function)
+{
+  const auto start = std::chrono::steady_clock::now();
+  double checksum = 0.0;
+
+  for(std::size_t request = 0; request < kRequests; ++request)
+  {
+    checksum += function(request);
+  }
+
+  const auto stop = std::chrono::steady_clock::now();
+  std::printf("  (checksum %g)\n", checksum);
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+double stdVectorRequest(const std::size_t request)
+{
+  std::vector<units::Feet> distances;
+  std::vector<units::Seconds> durations;
+
+  for(std::size_t index = 0; index < kSamples; ++index)
+  {
+    distances.emplace_back(double(request + index));
+    durations.emplace_back(1.0 + double(index));
+  }
+
+  std::vector<units::Metres> metres;
+  metres.reserve(distances.size());
+  for(const auto distance: distances)
+  {
+    metres.push_back(units::quantityCast<units::Metres>(distance));
+  }
+
+  std::vector<decltype(metres.front() / durations.front())> speeds;
+  speeds.reserve(metres.size());
+  for(std::size_t index = 0; index < metres.size(); ++index)
+  {
+    speeds.push_back(metres[index] / durations[index]);
+  }
+
+  return speeds.back().scalar();
+}
+
+double arenaRequest(units::pmr::BumpArena& arena, const std::size_t request)
+{
+  double result;
+
+  {
+    units::pmr::QuantityVector<units::Feet> distances(&arena);
+    units::pmr::QuantityVector<units::Seconds> durations(&arena);
+
+    for(std::size_t index = 0; index < kSamples; ++index)
+    {
+      distances.emplace_back(double(request + index));
+      durations.emplace_back(1.0 + double(index));
+    }
+
+    const auto metres = units::pmr::convert<units::Metres>(distances);
+    const auto speeds = units::pmr::transform(
+        metres,
+        durations,
+        [](const units::Metres d, const units::Seconds t) { return d / t; });
+
+    result = speeds.back().scalar();
+  }
+
+  arena.reset();
+  return result;
+}
+
+} // End of anonymous namespace.
+
+int main()
+{
+  units::pmr::BumpArena arena(64U * 1024U);
+
+  std::printf("std::vector\n");
+  const double vectorMilliseconds = timeRequests(stdVectorRequest);
+
+  std::printf("units::pmr::QuantityVector + BumpArena\n");
+  const double arenaMilliseconds =
+      timeRequests([&arena](const std::size_t request) { return arenaRequest(arena, request); });
+
+  std::printf(
+      "%zu requests x %zu samples: std::vector %.2f ms, arena %.2f ms (%.2fx), "
+      "arena overflows %zu\n",
+      kRequests,
+      kSamples,
+      vectorMilliseconds,
+      arenaMilliseconds,
+      vectorMilliseconds / arenaMilliseconds,
+      arena.overflowCount());
+
+  return 0;
+}
\ No newline at end of file
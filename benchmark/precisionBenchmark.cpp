@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <units/imperial.hpp>
+#include <units/precision.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+/// Compares the throughput and accuracy of the precision policies of precision.hpp on a column of
+/// inches converted to metres. The inputs are multiples of 1/8 inch, for which x * 127 is exact,
+/// so that fl(x * 127) / 5000 is the correctly rounded reference.
+
+namespace
+{
+
+constexpr std::size_t kSamples = 1U << 16U;
+constexpr std::size_t kRepetitions = 2000U;
+
+std::int64_t ulpDistance(const double lhs, const double rhs)
+{
+  std::int64_t lhsBits;
+  std::int64_t rhsBits;
+  std::memcpy(&lhsBits, &lhs, sizeof(lhsBits));
+  std::memcpy(&rhsBits, &rhs, sizeof(rhsBits));
+  return lhsBits > rhsBits ? lhsBits - rhsBits : rhsBits - lhsBits;
+}
+
+template<typename Precision>
+void run(const char* name, const std::vector<units::Inches>& inches)
+{
+  std::vector<units::Metres> metres(inches.size());
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for(std::size_t repetition = 0; repetition < kRepetitions; ++repetition)
+  {
+    for(std::size_t index = 0; index < inches.size(); ++index)
+    {
+      metres[index] = units::quantityCast<units::Metres, Precision>(inches[index]);
+    }
+  }
+
+  const auto stop = std::chrono::steady_clock::now();
+  const double nanoseconds = std::chrono::duration<double, std::nano>(stop - start).count() /
+                             double(kRepetitions * inches.size());
+
+  std::int64_t maximumUlps = 0;
+  std::size_t inexact = 0;
+
+  for(std::size_t index = 0; index < inches.size(); ++index)
+  {
+    const double reference = inches[index].scalar() * 127.0 / 5000.0;
+    const std::int64_t ulps = ulpDistance(reference, metres[index].scalar());
+    maximumUlps = ulps > maximumUlps ? ulps : maximumUlps;
+    inexact += (ulps != 0);
+  }
+
+  std::printf(
+      "%-24s %6.3f ns / conversion, max error %lld ulp, %zu of %zu not correctly rounded\n",
+      name,
+      nanoseconds,
+      static_cast<long long>(maximumUlps),
+      inexact,
+      inches.size());
+}
+
+} // End of anonymous namespace.
+
+int main()
+{
+  std::vector<units::Inches> inches;
+  inches.reserve(kSamples);
+
+  for(std::size_t index = 0; index < kSamples; ++index)
+  {
+    inches.emplace_back(double(index + 1U) * 0.125);
+  }
+
+  run<units::FastPrecision>("FastPrecision", inches);
+  run<units::ExactRatioPrecision>("ExactRatioPrecision", inches);
+  run<units::DoubleDoublePrecision>("DoubleDoublePrecision", inches);
+
+  return 0;
+}
\ No newline at end of file
@@ -23,12 +23,339 @@
  */
 #pragma once
 
+#include "conversionAudit.hpp"
 #include "physicalUnits.hpp"
-#include <ostream>
 
 namespace units
 {
 
+/// @brief  Conversion policy under which a quantity converts implicitly to and from any other
+///         physical units of the same physical dimensions. This is the default.
+class ImplicitConversionPolicy
+{
+public:
+  using SelfType = ImplicitConversionPolicy;
+
+  ImplicitConversionPolicy() = delete;
+
+  ImplicitConversionPolicy(const ImplicitConversionPolicy&) = delete;
+
+  ImplicitConversionPolicy(ImplicitConversionPolicy&&) = delete;
+
+  ~ImplicitConversionPolicy() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Conversion policy under which a quantity never rescales silently. The converting
+///         constructor only accepts physical units of identical scale, the mixed-unit operators
+///         take no part in overload resolution for operands that would need rescaling and every
+///         other conversion has to be spelled out with quantityCast<>. Meant for hot code where
+///         each multiply counts.
+///
+///         EG: ExplicitQuantity<Metres>(1.0) + Metres(1.0) compiles and costs one addition.
+///             ExplicitQuantity<Metres>(1.0) + Inches(1.0) does not compile.
+class ExplicitConversionPolicy
+{
+public:
+  using SelfType = ExplicitConversionPolicy;
+
+  ExplicitConversionPolicy() = delete;
+
+  ExplicitConversionPolicy(const ExplicitConversionPolicy&) = delete;
+
+  ExplicitConversionPolicy(ExplicitConversionPolicy&&) = delete;
+
+  ~ExplicitConversionPolicy() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+namespace detail
+{
+
+template<typename FromPhysicalUnits, typename ToPhysicalUnits>
+struct IsUnitScale
+    : std::is_same<
+          typename DivideScales<
+              typename FromPhysicalUnits::Scale,
+              typename ToPhysicalUnits::Scale>::Result,
+          std::ratio<1>>
+{
+};
+
+/// Rescales @param value from FromPhysicalUnits into ToPhysicalUnits. The multiply is elided when
+/// the scales are identical, so that it is spared even in unoptimised builds and for packed
+/// representations.
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr FloatType rescale(const FloatType value, std::true_type) noexcept(true)
+{
+  static_assert(
+      std::is_same<
+          typename ToPhysicalUnits::PhysicalDimensions,
+          typename FromPhysicalUnits::PhysicalDimensions>::value,
+      "Requested scale computation for physical units of different physical dimensions.");
+
+  return value;
+}
+
+/// Integral counts are rescaled exactly as std::chrono::duration_cast does it: multiplied by the
+/// numerator and divided by the denominator of the ratio in the widest integer type, truncating
+/// toward zero. Multiplying by the ratio rounded to the integral type would truncate the ratio
+/// itself, e.g. nano to micro would scale by 0.
+template<typename Scale, typename FloatType>
+constexpr FloatType rescaleIntegral(const FloatType value, std::true_type) noexcept(true)
+{
+  using Wide =
+      std::conditional_t<std::is_signed<FloatType>::value, std::intmax_t, std::uintmax_t>;
+
+  return static_cast<FloatType>(
+      static_cast<Wide>(value) * static_cast<Wide>(Scale::num) / static_cast<Wide>(Scale::den));
+}
+
+/// Factored scales do not fit a std::ratio and go through long double instead.
+template<typename Scale, typename FloatType>
+constexpr FloatType rescaleIntegral(const FloatType value, std::false_type) noexcept(true)
+{
+  return static_cast<FloatType>(
+      static_cast<long double>(value) * ScaleValue<Scale, long double>::kValue);
+}
+
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr FloatType rescale(const FloatType value, std::false_type, std::true_type) noexcept(true)
+{
+  using Scale = typename PhysicalUnitsScale<ToPhysicalUnits, FromPhysicalUnits, FloatType>::Result;
+
+  return rescaleIntegral<Scale>(value, IsRatio<Scale>{});
+}
+
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr FloatType rescale(const FloatType value, std::false_type, std::false_type) noexcept(true)
+{
+  return value * PhysicalUnitsScale<ToPhysicalUnits, FromPhysicalUnits, FloatType>::kScale;
+}
+
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr FloatType rescale(const FloatType value, std::false_type) noexcept(true)
+{
+  return rescale<ToPhysicalUnits, FromPhysicalUnits>(
+      value, std::false_type{}, std::is_integral<FloatType>{});
+}
+
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr FloatType rescale(const FloatType value) noexcept(true)
+{
+  return rescale<ToPhysicalUnits, FromPhysicalUnits>(
+      value, IsUnitScale<FromPhysicalUnits, ToPhysicalUnits>{});
+}
+
+/// Sign of the remainder truncated when the integral @param value is rescaled by the std::ratio
+/// @tparam Scale.
+template<typename Scale, typename FloatType>
+constexpr int truncatedRemainder(const FloatType value, std::true_type) noexcept(true)
+{
+  using Wide =
+      std::conditional_t<std::is_signed<FloatType>::value, std::intmax_t, std::uintmax_t>;
+
+  const Wide remainder =
+      static_cast<Wide>(value) * static_cast<Wide>(Scale::num) % static_cast<Wide>(Scale::den);
+
+  return (remainder > 0 ? 1 : 0) - (remainder < 0 ? 1 : 0);
+}
+
+template<typename Scale, typename FloatType>
+constexpr int truncatedRemainder(const FloatType value, std::false_type) noexcept(true)
+{
+  const long double exact =
+      static_cast<long double>(value) * ScaleValue<Scale, long double>::kValue;
+  const long double truncated = static_cast<long double>(static_cast<FloatType>(exact));
+
+  return (exact > truncated ? 1 : 0) - (exact < truncated ? 1 : 0);
+}
+
+/// Sign of the remainder that rescaling @param value from FromPhysicalUnits into ToPhysicalUnits
+/// truncates. Only integral representations truncate; 0 for every other.
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr int truncatedRemainder(const FloatType, std::false_type, std::false_type) noexcept(true)
+{
+  return 0;
+}
+
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr int truncatedRemainder(const FloatType value, std::false_type, std::true_type)
+    noexcept(true)
+{
+  using Scale = typename PhysicalUnitsScale<ToPhysicalUnits, FromPhysicalUnits, FloatType>::Result;
+
+  return truncatedRemainder<Scale>(value, IsRatio<Scale>{});
+}
+
+template<
+    typename ToPhysicalUnits,
+    typename FromPhysicalUnits,
+    typename FloatType,
+    typename Integral>
+constexpr int truncatedRemainder(const FloatType, std::true_type, Integral) noexcept(true)
+{
+  return 0;
+}
+
+template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+constexpr int truncatedRemainder(const FloatType value) noexcept(true)
+{
+  return truncatedRemainder<ToPhysicalUnits, FromPhysicalUnits>(
+      value,
+      std::integral_constant<bool, IsUnitScale<FromPhysicalUnits, ToPhysicalUnits>::value>{},
+      std::is_integral<FloatType>{});
+}
+
+/// Representation of the product or quotient of magnitudes held in @tparam LhsFloatType and
+/// @tparam RhsFloatType. Identical representations combine as themselves, and a representation
+/// combines with its own scalar lane as the representation, e.g. Dual<double, N> with double.
+/// void otherwise.
+template<typename LhsFloatType, typename RhsFloatType>
+using CombinedRepresentation = std::conditional_t<
+    std::is_same<LhsFloatType, RhsFloatType>::value or
+        std::is_same<typename RepresentationTraits<LhsFloatType>::Scalar, RhsFloatType>::value,
+    LhsFloatType,
+    std::conditional_t<
+        std::is_same<typename RepresentationTraits<RhsFloatType>::Scalar, LhsFloatType>::value,
+        RhsFloatType,
+        void>>;
+
+/// A conversion is implicit if both sides allow it or if it does not rescale at all. The scale is
+/// only inspected in the latter case.
+template<
+    typename FromPhysicalUnits,
+    typename FromConversionPolicy,
+    typename ToPhysicalUnits,
+    typename ToConversionPolicy>
+struct IsImplicitlyConvertible
+    : std::conditional_t<
+          std::is_same<FromConversionPolicy, ImplicitConversionPolicy>::value and
+              std::is_same<ToConversionPolicy, ImplicitConversionPolicy>::value,
+          std::true_type,
+          IsUnitScale<FromPhysicalUnits, ToPhysicalUnits>>
+{
+};
+
+/// @brief  Right-hand operand of the mixed-unit operators of an affine quantity of
+///         @tparam PhysicalUnits. The operand is rescaled into those physical units as it is bound
+///         to the parameter of the operator, i.e. within the expression applying the operator,
+///         which is where the conversion audit attributes the conversion. Operands that cannot be
+///         converted implicitly do not bind, which takes the operator out of overload resolution.
+///         Integral operands keep the sign of the remainder truncated by the rescale so that the
+///         comparisons stay exact.
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+class MixedOperand
+{
+public:
+  using SelfType = MixedOperand<PhysicalUnits, FloatType, ConversionPolicy>;
+
+  template<
+      typename RhsPhysicalUnits,
+      typename RhsConversionPolicy,
+      typename = std::enable_if_t<IsImplicitlyConvertible<
+          RhsPhysicalUnits,
+          RhsConversionPolicy,
+          PhysicalUnits,
+          ConversionPolicy>::value>>
+  constexpr MixedOperand(
+      const AffineQuantity<RhsPhysicalUnits, FloatType, RhsConversionPolicy> rhs
+          UNITS_CONVERSION_AUDIT_PARAMETER) noexcept(true): // NOLINT(google-explicit-constructor)
+      mValue(rescale<PhysicalUnits, RhsPhysicalUnits>(rhs.scalar())),
+      mRemainder(truncatedRemainder<PhysicalUnits, RhsPhysicalUnits>(rhs.scalar()))
+  {
+    UNITS_CONVERSION_AUDIT_RECORD(RhsPhysicalUnits, PhysicalUnits);
+  }
+
+  constexpr FloatType scalar() const noexcept(true)
+  {
+    return mValue;
+  }
+
+  constexpr int remainder() const noexcept(true)
+  {
+    return mRemainder;
+  }
+
+private:
+  FloatType mValue;
+  int mRemainder;
+};
+
+/// Comparisons of a magnitude against the magnitude of a MixedOperand. Integral operands weigh the
+/// truncated remainder as well, so that 1 us < 1500 ns holds although 1500 ns truncates to 1 us.
+template<typename FloatType, bool = std::is_integral<FloatType>::value>
+struct MixedComparison
+{
+  using Mask = typename RepresentationTraits<FloatType>::Mask;
+
+  static constexpr Mask equal(const FloatType lhs, const FloatType rhs, int) noexcept(true)
+  {
+    return lhs == rhs;
+  }
+
+  static constexpr Mask less(const FloatType lhs, const FloatType rhs, int) noexcept(true)
+  {
+    return lhs < rhs;
+  }
+
+  static constexpr Mask lessEqual(const FloatType lhs, const FloatType rhs, int) noexcept(true)
+  {
+    return lhs <= rhs;
+  }
+
+  static constexpr Mask greater(const FloatType lhs, const FloatType rhs, int) noexcept(true)
+  {
+    return lhs > rhs;
+  }
+
+  static constexpr Mask greaterEqual(const FloatType lhs, const FloatType rhs, int) noexcept(true)
+  {
+    return lhs >= rhs;
+  }
+};
+
+template<typename FloatType>
+struct MixedComparison<FloatType, true>
+{
+  static constexpr bool equal(const FloatType lhs, const FloatType rhs, const int remainder)
+      noexcept(true)
+  {
+    return lhs == rhs and remainder == 0;
+  }
+
+  static constexpr bool less(const FloatType lhs, const FloatType rhs, const int remainder)
+      noexcept(true)
+  {
+    return lhs < rhs or (lhs == rhs and remainder > 0);
+  }
+
+  static constexpr bool lessEqual(const FloatType lhs, const FloatType rhs, const int remainder)
+      noexcept(true)
+  {
+    return lhs < rhs or (lhs == rhs and remainder >= 0);
+  }
+
+  static constexpr bool greater(const FloatType lhs, const FloatType rhs, const int remainder)
+      noexcept(true)
+  {
+    return lhs > rhs or (lhs == rhs and remainder < 0);
+  }
+
+  static constexpr bool greaterEqual(const FloatType lhs, const FloatType rhs, const int remainder)
+      noexcept(true)
+  {
+    return lhs > rhs or (lhs == rhs and remainder <= 0);
+  }
+};
+
+} // End of namespace detail.
 
 /// @brief  Template class to represent affine quantities of a certain physical units with the given
 /// representation.
@@ -36,15 +363,22 @@ namespace units
 /// @tparam 	PhysicalUnits_	Physical units of the affine quantity.
 ///
 /// @tparam 	FloatType_		Floating point representation to store the magnitude of the
-/// quantity.
+/// quantity. May also be a packed SIMD type such as std::experimental::simd<double>, in which case
+/// every operation acts lane-wise and comparisons return lane masks. See @class
+/// RepresentationTraits.
+///
+/// @tparam     ConversionPolicy_   One of ImplicitConversionPolicy (default) or
+/// ExplicitConversionPolicy. Quantities of the same physical units interoperate freely across
+/// policies.
 
-template<typename PhysicalUnits_, typename FloatType_>
+template<typename PhysicalUnits_, typename FloatType_, typename ConversionPolicy_>
 class AffineQuantity
 {
 public:
   using PhysicalUnits = PhysicalUnits_;
   using FloatType = FloatType_;
-  using SelfType = AffineQuantity<PhysicalUnits, FloatType>;
+  using ConversionPolicy = ConversionPolicy_;
+  using SelfType = AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>;
 
   /// @brief  Default constructor with 0 initialization.
   constexpr AffineQuantity() noexcept(true): mValue(0) {};
@@ -68,13 +402,32 @@ public:
   ///             different scales. Hence, they can be implicitly converted to each other's type
   ///             after accounting for the scale.
   ///
+  ///         Under ExplicitConversionPolicy on either side only conversions of identical scale are
+  ///         implicit. Use quantityCast<> for the others.
+  ///
+  ///         Integral representations are rescaled like std::chrono::duration_cast, i.e. exactly
+  ///         up to truncation toward zero of the result.
+  ///
+  ///         Every conversion is counted per call site if UNITS_CONVERSION_AUDIT is defined. See
+  ///         conversionAudit.hpp.
+  ///
   /// @tparam RhsPhysicalUnits
+  /// @tparam RhsConversionPolicy
   /// @param  rhs
-  template<typename RhsPhysicalUnits>
-  constexpr AffineQuantity(const AffineQuantity<RhsPhysicalUnits, FloatType> rhs) noexcept(
-      true): // NOLINT(google-explicit-constructor)
-      mValue(rhs.scalar() * PhysicalUnitsScale<PhysicalUnits, RhsPhysicalUnits, FloatType>::kScale)
+  template<
+      typename RhsPhysicalUnits,
+      typename RhsConversionPolicy,
+      typename = std::enable_if_t<detail::IsImplicitlyConvertible<
+          RhsPhysicalUnits,
+          RhsConversionPolicy,
+          PhysicalUnits,
+          ConversionPolicy>::value>>
+  constexpr AffineQuantity(
+      const AffineQuantity<RhsPhysicalUnits, FloatType, RhsConversionPolicy> rhs
+          UNITS_CONVERSION_AUDIT_PARAMETER) noexcept(true): // NOLINT(google-explicit-constructor)
+      mValue(detail::rescale<PhysicalUnits, RhsPhysicalUnits>(rhs.scalar()))
   {
+    UNITS_CONVERSION_AUDIT_RECORD(RhsPhysicalUnits, PhysicalUnits);
   }
 
   ~AffineQuantity() = default;
@@ -163,9 +516,11 @@ public:
   /// @tparam ReturnFloatType
   /// @return
   template<typename ReturnFloatType>
-  constexpr AffineQuantity<PhysicalUnits, ReturnFloatType> cast() const noexcept(true)
+  constexpr AffineQuantity<PhysicalUnits, ReturnFloatType, ConversionPolicy> cast() const
+      noexcept(true)
   {
-    return AffineQuantity<PhysicalUnits, ReturnFloatType>(static_cast<ReturnFloatType>(mValue));
+    return AffineQuantity<PhysicalUnits, ReturnFloatType, ConversionPolicy>(
+        static_cast<ReturnFloatType>(mValue));
   }
 
   /// @brief  Method to access the magnitude of affine quantity.
@@ -175,253 +530,394 @@ public:
     return mValue;
   }
 
+private:
+  using MixedOperand = detail::MixedOperand<PhysicalUnits, FloatType, ConversionPolicy>;
+  using Comparison = detail::MixedComparison<FloatType>;
+  using Mask = typename RepresentationTraits<FloatType>::Mask;
+
+public:
+  /// @brief  Mixed-unit addition. The RHS is converted into the physical units of the LHS. Takes no
+  ///         part in overload resolution if the RHS cannot be converted implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr SelfType operator+(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return SelfType(lhs.mValue + rhs.scalar());
+  }
+
+  /// @brief  Mixed-unit subtraction. The RHS is converted into the physical units of the LHS. Takes
+  ///         no part in overload resolution if the RHS cannot be converted implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr SelfType operator-(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return SelfType(lhs.mValue - rhs.scalar());
+  }
+
+  /// @brief  Mixed-unit equality comparison. The RHS is converted into the physical units of the
+  ///         LHS. Takes no part in overload resolution if the RHS cannot be converted implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr Mask operator==(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return Comparison::equal(lhs.mValue, rhs.scalar(), rhs.remainder());
+  }
+
+  /// @brief  Mixed-unit inequality comparison. The RHS is converted into the physical units of the
+  ///         LHS. Takes no part in overload resolution if the RHS cannot be converted implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr Mask operator!=(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return not Comparison::equal(lhs.mValue, rhs.scalar(), rhs.remainder());
+  }
+
+  /// @brief  Mixed-unit less-than comparison. The RHS is converted into the physical units of the
+  ///         LHS. Takes no part in overload resolution if the RHS cannot be converted implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr Mask operator<(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return Comparison::less(lhs.mValue, rhs.scalar(), rhs.remainder());
+  }
+
+  /// @brief  Mixed-unit less-than-or-equal comparison. The RHS is converted into the physical units
+  ///         of the LHS. Takes no part in overload resolution if the RHS cannot be converted
+  ///         implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr Mask operator<=(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return Comparison::lessEqual(lhs.mValue, rhs.scalar(), rhs.remainder());
+  }
+
+  /// @brief  Mixed-unit greater-than comparison. The RHS is converted into the physical units of
+  ///         the LHS. Takes no part in overload resolution if the RHS cannot be converted
+  ///         implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr Mask operator>(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return Comparison::greater(lhs.mValue, rhs.scalar(), rhs.remainder());
+  }
+
+  /// @brief  Mixed-unit greater-than-or-equal comparison. The RHS is converted into the physical
+  ///         units of the LHS. Takes no part in overload resolution if the RHS cannot be converted
+  ///         implicitly.
+  /// @param  lhs
+  /// @param  rhs
+  /// @return
+  friend constexpr Mask operator>=(const SelfType lhs, const MixedOperand rhs) noexcept(true)
+  {
+    return Comparison::greaterEqual(lhs.mValue, rhs.scalar(), rhs.remainder());
+  }
+
 private:
   FloatType mValue;
 };
 
-/// @brief
-/// @tparam PhysicalQuantityVectorType
-/// @param lhs
-/// @param rhs
+/// The affine quantity @tparam Quantity under ExplicitConversionPolicy.
+///
+/// EG: ExplicitQuantity<Metres>
+template<typename Quantity>
+using ExplicitQuantity = AffineQuantity<
+    typename Quantity::PhysicalUnits,
+    typename Quantity::FloatType,
+    ExplicitConversionPolicy>;
+
+/// @brief  Explicit conversion of a quantity into the physical units, representation and
+///         conversion policy of @tparam Target. Available under every conversion policy.
+///
+///         EG: quantityCast<ExplicitQuantity<Inches>>(metres)
+///
+/// @tparam Target  Specialization of AffineQuantity of the same physical dimensions.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  quantity
 /// @return
-template<typename AffineQuantity>
-constexpr AffineQuantity
-operator+(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename Target, typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr Target quantityCast(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> quantity
+        UNITS_CONVERSION_AUDIT_PARAMETER) noexcept(true)
 {
-  return AffineQuantity(lhs.scalar() + rhs.scalar());
-}
+  UNITS_CONVERSION_AUDIT_RECORD(PhysicalUnits, typename Target::PhysicalUnits);
 
-/// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
-/// @param lhs
-/// @param rhs
-/// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr LhsAffineQuantity
-operator+(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
-{
-  return lhs + LhsAffineQuantity(rhs);
+  return Target(static_cast<typename Target::FloatType>(
+      detail::rescale<typename Target::PhysicalUnits, PhysicalUnits>(quantity.scalar())));
 }
 
 /// @brief
-/// @tparam AffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename AffineQuantity>
-constexpr AffineQuantity
-operator-(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> operator+(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
-  return AffineQuantity(lhs.scalar() - rhs.scalar());
+  return AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>(lhs.scalar() + rhs.scalar());
 }
 
 /// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr LhsAffineQuantity
-operator-(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> operator-(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
-  return lhs - LhsAffineQuantity(rhs);
+  return AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>(lhs.scalar() - rhs.scalar());
 }
 
-/// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
+/// @brief  Multiplies two affine quantities. The physical units of the result are decided by
+///         @tparam ScalePolicy. Any scale factor required by the policy is folded into the
+///         multiplication of the magnitudes so that no further conversion is incurred downstream.
+///         The folded rescale is counted per call site if UNITS_CONVERSION_AUDIT is defined.
+///         The result takes the conversion policy of the LHS. The operands share a representation
+///         or one of them holds the scalar lane of the other, e.g. Dual<double, N> and double, in
+///         which case the result takes the wider representation.
+/// @tparam ScalePolicy     One of PreserveScalePolicy or CanonicalScalePolicy.
+/// @tparam LhsPhysicalUnits
+/// @tparam LhsFloatType
+/// @tparam RhsPhysicalUnits
+/// @tparam RhsFloatType
+/// @tparam LhsConversionPolicy
+/// @tparam RhsConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr decltype(auto)
-operator*(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
+template<
+    typename ScalePolicy,
+    typename LhsPhysicalUnits,
+    typename LhsFloatType,
+    typename RhsPhysicalUnits,
+    typename RhsFloatType,
+    typename LhsConversionPolicy,
+    typename RhsConversionPolicy>
+constexpr decltype(auto) multiply(
+    const AffineQuantity<LhsPhysicalUnits, LhsFloatType, LhsConversionPolicy> lhs,
+    const AffineQuantity<RhsPhysicalUnits, RhsFloatType, RhsConversionPolicy> rhs
+        UNITS_CONVERSION_AUDIT_PARAMETER) noexcept(true)
 {
+  using FloatType = detail::CombinedRepresentation<LhsFloatType, RhsFloatType>;
+
   static_assert(
-      std::is_same<
-          typename LhsAffineQuantity::FloatType,
-          typename RhsAffineQuantity::FloatType>::value,
+      not std::is_void<FloatType>::value,
       "Invalid request to multiply affine quantities of different underlying representation. Use "
-      "cast<> to change "
-      "the underlying representation of one of the operands to be the same as the other.");
+      "cast<> to change the underlying representation of one of the operands to be the same as "
+      "the other or to its scalar.");
 
-  using ResultType = AffineQuantity<
-      typename MultiplyPhysicalUnits<
-          typename LhsAffineQuantity::PhysicalUnits,
-          typename RhsAffineQuantity::PhysicalUnits>::Result,
-      typename LhsAffineQuantity::FloatType>;
+  using Multiplication = MultiplyPhysicalUnits<LhsPhysicalUnits, RhsPhysicalUnits, ScalePolicy>;
+  using ResultType =
+      AffineQuantity<typename Multiplication::Result, FloatType, LhsConversionPolicy>;
 
+  UNITS_CONVERSION_AUDIT_RECORD(
+      typename Multiplication::ExactResult, typename Multiplication::Result);
 
-  return ResultType(lhs.scalar() * rhs.scalar());
+  return ResultType(
+      detail::rescale<typename Multiplication::Result, typename Multiplication::ExactResult>(
+          static_cast<FloatType>(lhs.scalar() * rhs.scalar())));
 }
 
-/// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
+/// @brief  Divides two affine quantities. The physical units of the result are decided by
+///         @tparam ScalePolicy. Any scale factor required by the policy is folded into the
+///         division of the magnitudes so that no further conversion is incurred downstream.
+///         The folded rescale is counted per call site if UNITS_CONVERSION_AUDIT is defined.
+///         The result takes the conversion policy of the LHS. The operands share a representation
+///         or one of them holds the scalar lane of the other, e.g. Dual<double, N> and double, in
+///         which case the result takes the wider representation.
+/// @tparam ScalePolicy     One of PreserveScalePolicy or CanonicalScalePolicy.
+/// @tparam LhsPhysicalUnits
+/// @tparam LhsFloatType
+/// @tparam RhsPhysicalUnits
+/// @tparam RhsFloatType
+/// @tparam LhsConversionPolicy
+/// @tparam RhsConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr decltype(auto)
-operator/(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
+template<
+    typename ScalePolicy,
+    typename LhsPhysicalUnits,
+    typename LhsFloatType,
+    typename RhsPhysicalUnits,
+    typename RhsFloatType,
+    typename LhsConversionPolicy,
+    typename RhsConversionPolicy>
+constexpr decltype(auto) divide(
+    const AffineQuantity<LhsPhysicalUnits, LhsFloatType, LhsConversionPolicy> lhs,
+    const AffineQuantity<RhsPhysicalUnits, RhsFloatType, RhsConversionPolicy> rhs
+        UNITS_CONVERSION_AUDIT_PARAMETER) noexcept(true)
 {
+  using FloatType = detail::CombinedRepresentation<LhsFloatType, RhsFloatType>;
+
   static_assert(
-      std::is_same<
-          typename LhsAffineQuantity::FloatType,
-          typename RhsAffineQuantity::FloatType>::value,
+      not std::is_void<FloatType>::value,
       "Invalid request to divide affine quantities of different underlying representation. Use "
-      "cast<> to change "
-      "the underlying representation of one of the operands to be the same as the other.");
+      "cast<> to change the underlying representation of one of the operands to be the same as "
+      "the other or to its scalar.");
 
-  using ResultType = AffineQuantity<
-      typename DividePhysicalUnits<
-          typename LhsAffineQuantity::PhysicalUnits,
-          typename RhsAffineQuantity::PhysicalUnits>::Result,
-      typename LhsAffineQuantity::FloatType>;
+  using Division = DividePhysicalUnits<LhsPhysicalUnits, RhsPhysicalUnits, ScalePolicy>;
+  using ResultType = AffineQuantity<typename Division::Result, FloatType, LhsConversionPolicy>;
 
+  UNITS_CONVERSION_AUDIT_RECORD(typename Division::ExactResult, typename Division::Result);
 
-  return ResultType(lhs.scalar() / rhs.scalar());
+  return ResultType(
+      detail::rescale<typename Division::Result, typename Division::ExactResult>(
+          static_cast<FloatType>(lhs.scalar() / rhs.scalar())));
 }
 
-/// @brief
-/// @tparam AffineQuantity
+/// @brief  Multiplies two affine quantities using the DefaultScalePolicy.
+/// @tparam LhsPhysicalUnits
+/// @tparam LhsFloatType
+/// @tparam RhsPhysicalUnits
+/// @tparam RhsFloatType
+/// @tparam LhsConversionPolicy
+/// @tparam RhsConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename AffineQuantity>
-constexpr bool operator==(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<
+    typename LhsPhysicalUnits,
+    typename LhsFloatType,
+    typename RhsPhysicalUnits,
+    typename RhsFloatType,
+    typename LhsConversionPolicy,
+    typename RhsConversionPolicy>
+constexpr decltype(auto) operator*(
+    const AffineQuantity<LhsPhysicalUnits, LhsFloatType, LhsConversionPolicy> lhs,
+    const AffineQuantity<RhsPhysicalUnits, RhsFloatType, RhsConversionPolicy> rhs) noexcept(true)
 {
-  return lhs.scalar() == rhs.scalar();
+  return multiply<DefaultScalePolicy>(lhs, rhs);
 }
 
-/// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
+/// @brief  Divides two affine quantities using the DefaultScalePolicy.
+/// @tparam LhsPhysicalUnits
+/// @tparam LhsFloatType
+/// @tparam RhsPhysicalUnits
+/// @tparam RhsFloatType
+/// @tparam LhsConversionPolicy
+/// @tparam RhsConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr bool operator==(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
+template<
+    typename LhsPhysicalUnits,
+    typename LhsFloatType,
+    typename RhsPhysicalUnits,
+    typename RhsFloatType,
+    typename LhsConversionPolicy,
+    typename RhsConversionPolicy>
+constexpr decltype(auto) operator/(
+    const AffineQuantity<LhsPhysicalUnits, LhsFloatType, LhsConversionPolicy> lhs,
+    const AffineQuantity<RhsPhysicalUnits, RhsFloatType, RhsConversionPolicy> rhs) noexcept(true)
 {
-  return lhs == LhsAffineQuantity(rhs);
+  return divide<DefaultScalePolicy>(lhs, rhs);
 }
 
 /// @brief
-/// @tparam AffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename AffineQuantity>
-constexpr bool operator!=(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr typename RepresentationTraits<FloatType>::Mask operator==(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
-  return not(lhs == rhs);
+  return lhs.scalar() == rhs.scalar();
 }
 
 /// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr bool operator!=(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr typename RepresentationTraits<FloatType>::Mask operator!=(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
   return not(lhs == rhs);
 }
 
 /// @brief
-/// @tparam AffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename AffineQuantity>
-constexpr bool operator<(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr typename RepresentationTraits<FloatType>::Mask operator<(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
   return lhs.scalar() < rhs.scalar();
 }
 
 /// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr bool operator<(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
-{
-  return lhs < LhsAffineQuantity(rhs);
-}
-
-/// @brief
-/// @tparam AffineQuantity
-/// @param lhs
-/// @param rhs
-/// @return
-template<typename AffineQuantity>
-constexpr bool operator<=(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr typename RepresentationTraits<FloatType>::Mask operator<=(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
   return lhs.scalar() <= rhs.scalar();
 }
 
 /// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
-/// @param lhs
-/// @param rhs
-/// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr bool operator<=(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
-{
-  return lhs <= LhsAffineQuantity(rhs);
-}
-
-/// @brief
-/// @tparam AffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename AffineQuantity>
-constexpr bool operator>(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr typename RepresentationTraits<FloatType>::Mask operator>(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
   return lhs.scalar() > rhs.scalar();
 }
 
 /// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
-/// @param lhs
-/// @param rhs
-/// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr bool operator>(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
-{
-  return lhs > LhsAffineQuantity(rhs);
-}
-
-/// @brief
-/// @tparam AffineQuantity
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
 /// @param lhs
 /// @param rhs
 /// @return
-template<typename AffineQuantity>
-constexpr bool operator>=(const AffineQuantity lhs, const AffineQuantity rhs) noexcept(true)
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr typename RepresentationTraits<FloatType>::Mask operator>=(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> lhs,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> rhs) noexcept(true)
 {
   return lhs.scalar() >= rhs.scalar();
 }
 
-/// @brief
-/// @tparam LhsAffineQuantity
-/// @tparam RhsAffineQuantity
-/// @param lhs
-/// @param rhs
-/// @return
-template<typename LhsAffineQuantity, typename RhsAffineQuantity>
-constexpr bool operator>=(const LhsAffineQuantity lhs, const RhsAffineQuantity rhs) noexcept(true)
-{
-  return lhs >= LhsAffineQuantity(rhs);
-}
-
-
 } // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,564 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace units
+{
+
+/// Rational approximation of π. It is the convergent of the continued fraction of π closest to it
+/// within std::intmax_t headroom for the scales below, and rounds to the same double as M_PI.
+using PiRatio = std::ratio<245850922, 78256779>;
+
+/// Physical units representing angles in degrees.
+using DegreesPhysicalUnit = PhysicalUnits<Angle, std::ratio_divide<PiRatio, std::ratio<180>>>;
+
+/// Physical units representing angles in full turns.
+using TurnsPhysicalUnit = PhysicalUnits<Angle, std::ratio_multiply<PiRatio, std::ratio<2>>>;
+
+/// Degrees
+using Degrees = AffineQuantity<DegreesPhysicalUnit, double>;
+
+/// Turns
+using Turns = AffineQuantity<TurnsPhysicalUnit, double>;
+
+namespace detail
+{
+
+/// Wraps a real number of counts onto the 2^digits counts of a turn, rounding to nearest with the
+/// current rounding mode. NaN and infinities map to 0. The SIMD kernels below implement the exact
+/// same arithmetic.
+template<typename StorageUInt, typename FloatType>
+StorageUInt wrapToTurn(const FloatType counts) noexcept(true)
+{
+  constexpr FloatType kCountsPerTurn =
+      FloatType(std::uint64_t(1) << std::numeric_limits<StorageUInt>::digits);
+
+  const FloatType wrapped = std::fmod(counts, kCountsPerTurn);
+  if(not(wrapped == wrapped))
+  {
+    return StorageUInt(0);
+  }
+
+  return static_cast<StorageUInt>(static_cast<std::int64_t>(std::nearbyint(wrapped)));
+}
+
+template<typename StorageUInt, typename FloatType>
+inline void toBinaryAnglesKernel(
+    const FloatType* const values,
+    const std::size_t size,
+    const FloatType scale,
+    StorageUInt* const counts) noexcept(true)
+{
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    counts[index] = wrapToTurn<StorageUInt>(values[index] * scale);
+  }
+}
+
+template<typename StorageUInt, typename FloatType>
+inline void fromBinaryAnglesKernel(
+    const StorageUInt* const counts,
+    const std::size_t size,
+    const FloatType scale,
+    FloatType* const values) noexcept(true)
+{
+  using SignedCount = std::make_signed_t<StorageUInt>;
+
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    values[index] = FloatType(static_cast<SignedCount>(counts[index])) * scale;
+  }
+}
+
+/// Radians per count of a 32-bit binary angle.
+constexpr float kRadiansPerTurnCount =
+    float(ScaleValue<typename TurnsPhysicalUnit::Scale, double>::kValue / 4294967296.0);
+
+/// Taylor coefficients of sin and cos. On [-π/4, π/4] the truncation error of the degree 9 and 8
+/// polynomials is below 2e-9, far under the rounding error of float.
+constexpr float kSine3 = -1.0F / 6.0F;
+constexpr float kSine5 = 1.0F / 120.0F;
+constexpr float kSine7 = -1.0F / 5040.0F;
+constexpr float kSine9 = 1.0F / 362880.0F;
+constexpr float kCosine2 = -1.0F / 2.0F;
+constexpr float kCosine4 = 1.0F / 24.0F;
+constexpr float kCosine6 = -1.0F / 720.0F;
+constexpr float kCosine8 = 1.0F / 40320.0F;
+
+/// Sine and cosine of @param turn, a 32-bit fraction of a turn. The turn is split exactly, in
+/// integer arithmetic, into the nearest quadrant and an offset in [-π/4, π/4) on which both
+/// polynomials are evaluated. One operation per statement keeps compilers from contracting them
+/// into FMAs; the SIMD kernels below implement the exact same arithmetic.
+inline void sinCosOfTurn(const std::uint32_t turn, float& sine, float& cosine) noexcept(true)
+{
+  const std::uint32_t quadrant = (turn + (std::uint32_t(1) << 29U)) >> 30U;
+  const float x =
+      float(static_cast<std::int32_t>(turn - (quadrant << 30U))) * kRadiansPerTurnCount;
+  const float x2 = x * x;
+
+  float s = kSine9 * x2;
+  s += kSine7;
+  s *= x2;
+  s += kSine5;
+  s *= x2;
+  s += kSine3;
+  s *= x2;
+  s *= x;
+  s += x;
+
+  float c = kCosine8 * x2;
+  c += kCosine6;
+  c *= x2;
+  c += kCosine4;
+  c *= x2;
+  c += kCosine2;
+  c *= x2;
+  c += 1.0F;
+
+  // Quadrant q shifts the angle by q quarter turns: odd ones swap sine and cosine, and the signs
+  // follow the second bit of q and of q + 1 respectively.
+  const bool swap = (quadrant & 1U) != 0U;
+  const float sineMagnitude = swap ? c : s;
+  const float cosineMagnitude = swap ? s : c;
+
+  sine = (quadrant & 2U) != 0U ? -sineMagnitude : sineMagnitude;
+  cosine = ((quadrant + 1U) & 2U) != 0U ? -cosineMagnitude : cosineMagnitude;
+}
+
+template<typename StorageUInt>
+inline void sinCosKernel(
+    const StorageUInt* const counts,
+    const std::size_t size,
+    float* const sines,
+    float* const cosines) noexcept(true)
+{
+  constexpr unsigned kShift = 32U - std::numeric_limits<StorageUInt>::digits;
+
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    sinCosOfTurn(std::uint32_t(counts[index]) << kShift, sines[index], cosines[index]);
+  }
+}
+
+#if defined(__AVX2__)
+
+inline void toBinaryAnglesKernel(
+    const float* const values,
+    const std::size_t size,
+    const float scale,
+    std::uint16_t* const counts) noexcept(true)
+{
+  const __m256 factor = _mm256_set1_ps(scale);
+  const __m256 turn = _mm256_set1_ps(65536.0F);
+  const __m256 inverseTurn = _mm256_set1_ps(1.0F / 65536.0F);
+  const __m256i mask = _mm256_set1_epi32(0xFFFF);
+
+  // x - floor(x / 2^16) * 2^16 is exact and differs from fmod by whole turns only.
+  const auto wrap = [&](const __m256 value)
+  {
+    const __m256 scaled = _mm256_mul_ps(value, factor);
+    const __m256 turns = _mm256_floor_ps(_mm256_mul_ps(scaled, inverseTurn));
+    const __m256 wrapped = _mm256_sub_ps(scaled, _mm256_mul_ps(turns, turn));
+
+    return _mm256_and_si256(_mm256_cvtps_epi32(wrapped), mask);
+  };
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    // packus interleaves the 128-bit lanes of its operands; the permute restores the order.
+    const __m256i packed = _mm256_packus_epi32(
+        wrap(_mm256_loadu_ps(values + index)),
+        wrap(_mm256_loadu_ps(values + index + 8)));
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(counts + index), _mm256_permute4x64_epi64(packed, 0xD8));
+  }
+
+  toBinaryAnglesKernel<std::uint16_t, float>(values + index, size - index, scale, counts + index);
+}
+
+inline void fromBinaryAnglesKernel(
+    const std::uint16_t* const counts,
+    const std::size_t size,
+    const float scale,
+    float* const values) noexcept(true)
+{
+  const __m256 factor = _mm256_set1_ps(scale);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256i widened =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(counts + index)));
+
+    _mm256_storeu_ps(values + index, _mm256_mul_ps(_mm256_cvtepi32_ps(widened), factor));
+  }
+
+  fromBinaryAnglesKernel<std::uint16_t, float>(counts + index, size - index, scale, values + index);
+}
+
+inline void sinCosOfTurns(const __m256i turn, __m256& sine, __m256& cosine) noexcept(true)
+{
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i two = _mm256_set1_epi32(2);
+
+  const __m256i quadrant =
+      _mm256_srli_epi32(_mm256_add_epi32(turn, _mm256_set1_epi32(1 << 29)), 30);
+  const __m256 x = _mm256_mul_ps(
+      _mm256_cvtepi32_ps(_mm256_sub_epi32(turn, _mm256_slli_epi32(quadrant, 30))),
+      _mm256_set1_ps(kRadiansPerTurnCount));
+  const __m256 x2 = _mm256_mul_ps(x, x);
+
+  __m256 s = _mm256_mul_ps(_mm256_set1_ps(kSine9), x2);
+  s = _mm256_mul_ps(_mm256_add_ps(s, _mm256_set1_ps(kSine7)), x2);
+  s = _mm256_mul_ps(_mm256_add_ps(s, _mm256_set1_ps(kSine5)), x2);
+  s = _mm256_mul_ps(_mm256_add_ps(s, _mm256_set1_ps(kSine3)), x2);
+  s = _mm256_add_ps(_mm256_mul_ps(s, x), x);
+
+  __m256 c = _mm256_mul_ps(_mm256_set1_ps(kCosine8), x2);
+  c = _mm256_mul_ps(_mm256_add_ps(c, _mm256_set1_ps(kCosine6)), x2);
+  c = _mm256_mul_ps(_mm256_add_ps(c, _mm256_set1_ps(kCosine4)), x2);
+  c = _mm256_mul_ps(_mm256_add_ps(c, _mm256_set1_ps(kCosine2)), x2);
+  c = _mm256_add_ps(c, _mm256_set1_ps(1.0F));
+
+  const __m256 swap =
+      _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+  const __m256 sineSign =
+      _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+  const __m256 cosineSign = _mm256_castsi256_ps(
+      _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+
+  sine = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sineSign);
+  cosine = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosineSign);
+}
+
+inline void sinCosKernel(
+    const std::uint16_t* const counts,
+    const std::size_t size,
+    float* const sines,
+    float* const cosines) noexcept(true)
+{
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256i turn = _mm256_slli_epi32(
+        _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(counts + index))),
+        16);
+
+    __m256 sine;
+    __m256 cosine;
+    sinCosOfTurns(turn, sine, cosine);
+
+    _mm256_storeu_ps(sines + index, sine);
+    _mm256_storeu_ps(cosines + index, cosine);
+  }
+
+  sinCosKernel<std::uint16_t>(counts + index, size - index, sines + index, cosines + index);
+}
+
+inline void sinCosKernel(
+    const std::uint32_t* const counts,
+    const std::size_t size,
+    float* const sines,
+    float* const cosines) noexcept(true)
+{
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    __m256 sine;
+    __m256 cosine;
+    sinCosOfTurns(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counts + index)), sine, cosine);
+
+    _mm256_storeu_ps(sines + index, sine);
+    _mm256_storeu_ps(cosines + index, cosine);
+  }
+
+  sinCosKernel<std::uint32_t>(counts + index, size - index, sines + index, cosines + index);
+}
+
+#endif
+
+} // End of namespace detail.
+
+/// @brief  Template class to represent an angle in binary angle measurement (BAM): an unsigned
+///         integer fraction of a full turn, one count being 2^-digits of a turn. Wraparound is
+///         free from the modular arithmetic of unsigned integers, so angles never need to be
+///         re-wrapped with fmod. The difference of two angles read as a signed count is the
+///         shortest-arc delta from the RHS to the LHS.
+///
+///         EG: BinaryAngle<std::uint16_t> resolves a turn into 65536 counts of ~0.0055°.
+///
+/// @tparam StorageUInt_    Unsigned integer type of the count.
+
+template<typename StorageUInt_>
+class BinaryAngle
+{
+public:
+  using StorageUInt = StorageUInt_;
+  using SelfType = BinaryAngle<StorageUInt>;
+
+  static_assert(
+      std::is_unsigned<StorageUInt>::value and std::numeric_limits<StorageUInt>::digits <= 32,
+      "The storage of a binary angle is required to be an unsigned integer of at most 32 bits.");
+
+  static constexpr unsigned kDigits = std::numeric_limits<StorageUInt>::digits;
+
+  /// Physical units of a single count.
+  using LSBPhysicalUnits = PhysicalUnits<
+      Angle,
+      typename MultiplyScales<
+          typename TurnsPhysicalUnit::Scale,
+          std::ratio<1, std::intmax_t(1) << kDigits>>::Result>;
+
+  /// @brief  Default constructor with 0 initialization.
+  constexpr BinaryAngle() noexcept(true): mCount(0) {}
+
+  /// @brief  Construction from a raw count.
+  /// @param  count
+  explicit constexpr BinaryAngle(const StorageUInt count) noexcept(true): mCount(count) {}
+
+  /// @brief  Wraps an angle of any physical units of the Angle dimension onto the turn, rounding
+  ///         to the nearest count. NaN and infinities map to 0.
+  /// @tparam PhysicalUnits
+  /// @tparam FloatType
+  /// @tparam ConversionPolicy
+  /// @param  angle
+  /// @return
+  template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+  static SelfType fromAngle(
+      const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> angle) noexcept(true)
+  {
+    return SelfType(detail::wrapToTurn<StorageUInt>(
+        angle.scalar() * PhysicalUnitsScale<LSBPhysicalUnits, PhysicalUnits, FloatType>::kScale));
+  }
+
+  /// @brief  Converts into the angle @tparam Target in [-half turn, half turn).
+  /// @tparam Target
+  /// @return
+  template<typename Target>
+  constexpr Target toAngle() const noexcept(true)
+  {
+    using FloatType = typename Target::FloatType;
+
+    return Target(
+        FloatType(static_cast<std::make_signed_t<StorageUInt>>(mCount)) *
+        PhysicalUnitsScale<typename Target::PhysicalUnits, LSBPhysicalUnits, FloatType>::kScale);
+  }
+
+  /// @brief  Method to access the raw count.
+  /// @return
+  constexpr StorageUInt count() const noexcept(true)
+  {
+    return mCount;
+  }
+
+  /// @brief  Addition assignment operator. Wraps around the turn.
+  /// @param  rhs
+  /// @return
+  constexpr SelfType& operator+=(const SelfType rhs) noexcept(true)
+  {
+    mCount = static_cast<StorageUInt>(mCount + rhs.mCount);
+    return *this;
+  }
+
+  /// @brief  Subtraction assignment operator. Wraps around the turn.
+  /// @param  rhs
+  /// @return
+  constexpr SelfType& operator-=(const SelfType rhs) noexcept(true)
+  {
+    mCount = static_cast<StorageUInt>(mCount - rhs.mCount);
+    return *this;
+  }
+
+private:
+  StorageUInt mCount;
+};
+
+/// @brief
+/// @tparam StorageUInt
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename StorageUInt>
+constexpr BinaryAngle<StorageUInt> operator+(
+    BinaryAngle<StorageUInt> lhs,
+    const BinaryAngle<StorageUInt> rhs) noexcept(true)
+{
+  return lhs += rhs;
+}
+
+/// @brief  Difference of two angles. Read through toAngle<>() it is the shortest-arc delta from
+///         the RHS to the LHS.
+/// @tparam StorageUInt
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename StorageUInt>
+constexpr BinaryAngle<StorageUInt> operator-(
+    BinaryAngle<StorageUInt> lhs,
+    const BinaryAngle<StorageUInt> rhs) noexcept(true)
+{
+  return lhs -= rhs;
+}
+
+/// @brief
+/// @tparam StorageUInt
+/// @param angle
+/// @return
+template<typename StorageUInt>
+constexpr BinaryAngle<StorageUInt> operator-(const BinaryAngle<StorageUInt> angle) noexcept(true)
+{
+  return BinaryAngle<StorageUInt>() - angle;
+}
+
+/// @brief
+/// @tparam StorageUInt
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename StorageUInt>
+constexpr bool operator==(
+    const BinaryAngle<StorageUInt> lhs,
+    const BinaryAngle<StorageUInt> rhs) noexcept(true)
+{
+  return lhs.count() == rhs.count();
+}
+
+/// @brief
+/// @tparam StorageUInt
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename StorageUInt>
+constexpr bool operator!=(
+    const BinaryAngle<StorageUInt> lhs,
+    const BinaryAngle<StorageUInt> rhs) noexcept(true)
+{
+  return not(lhs == rhs);
+}
+
+/// @brief  Bulk conversion of @param size angles into binary angles. Equivalent to calling
+///         fromAngle on every element. float into 16-bit angles is vectorized with AVX2 when
+///         enabled at compile time.
+/// @tparam StorageUInt
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  input
+/// @param  size
+/// @param  output
+template<
+    typename StorageUInt,
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy>
+void toBinaryAngles(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const input,
+    const std::size_t size,
+    BinaryAngle<StorageUInt>* const output) noexcept(true)
+{
+  static_assert(
+      sizeof(BinaryAngle<StorageUInt>) == sizeof(StorageUInt) and
+          sizeof(AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>) == sizeof(FloatType),
+      "Bulk conversion requires angles to be laid out as their underlying representation.");
+
+  detail::toBinaryAnglesKernel(
+      reinterpret_cast<const FloatType*>(input),
+      size,
+      PhysicalUnitsScale<
+          typename BinaryAngle<StorageUInt>::LSBPhysicalUnits,
+          PhysicalUnits,
+          FloatType>::kScale,
+      reinterpret_cast<StorageUInt*>(output));
+}
+
+/// @brief  Bulk conversion of @param size binary angles into the angle @tparam Target in
+///         [-half turn, half turn). Equivalent to calling toAngle<Target>() on every element.
+///         16-bit angles into float are vectorized with AVX2 when enabled at compile time.
+/// @tparam Target
+/// @tparam StorageUInt
+/// @param  input
+/// @param  size
+/// @param  output
+template<typename Target, typename StorageUInt>
+void fromBinaryAngles(
+    const BinaryAngle<StorageUInt>* const input,
+    const std::size_t size,
+    Target* const output) noexcept(true)
+{
+  using FloatType = typename Target::FloatType;
+
+  static_assert(
+      sizeof(BinaryAngle<StorageUInt>) == sizeof(StorageUInt) and
+          sizeof(Target) == sizeof(FloatType),
+      "Bulk conversion requires angles to be laid out as their underlying representation.");
+
+  detail::fromBinaryAnglesKernel(
+      reinterpret_cast<const StorageUInt*>(input),
+      size,
+      PhysicalUnitsScale<
+          typename Target::PhysicalUnits,
+          typename BinaryAngle<StorageUInt>::LSBPhysicalUnits,
+          FloatType>::kScale,
+      reinterpret_cast<FloatType*>(output));
+}
+
+/// @brief  Bulk sine and cosine of @param size binary angles. The count is split exactly into the
+///         nearest quadrant and an offset of at most an eighth of a turn, on which degree 9 and 8
+///         polynomials are evaluated in float; the quadrant then swaps and negates the results.
+///         The absolute error is below 2e-7. 16- and 32-bit angles are vectorized with AVX2 when
+///         enabled at compile time and give the same results as the scalar path.
+/// @tparam StorageUInt
+/// @param  input
+/// @param  size
+/// @param  sines
+/// @param  cosines
+template<typename StorageUInt>
+void sinCos(
+    const BinaryAngle<StorageUInt>* const input,
+    const std::size_t size,
+    float* const sines,
+    float* const cosines) noexcept(true)
+{
+  static_assert(
+      sizeof(BinaryAngle<StorageUInt>) == sizeof(StorageUInt),
+      "Bulk sine and cosine require angles to be laid out as their underlying representation.");
+
+  detail::sinCosKernel(reinterpret_cast<const StorageUInt*>(input), size, sines, cosines);
+}
+
+} // End of namespace units.
\ No newline at end of file
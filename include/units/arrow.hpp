@@ -0,0 +1,429 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include "span.hpp"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/// Zero-copy export and import of columns of affine quantities through the Apache Arrow C Data
+/// Interface. A column is a primitive Arrow array without a validity bitmap whose schema carries
+/// the physical units in its metadata:
+///
+///     units.dimensions    Exponents of L, M, T, I, K, N, J e.g. "1,0,-1,0,0,0,0" or "1/2,0,...".
+///     units.scale         Scale w.r.t. the coherent S.I. unit e.g. "381/1250".
+///
+/// The units are validated once per imported column; the samples are never copied or converted.
+
+/// Structures of the Arrow C Data Interface, verbatim from the specification. The guard lets them
+/// coexist with the Arrow C++ library or any other header that defines them.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema
+{
+  // Array type description
+  const char* format;
+  const char* name;
+  const char* metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema** children;
+  struct ArrowSchema* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowSchema*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+struct ArrowArray
+{
+  // Array data description
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void** buffers;
+  struct ArrowArray** children;
+  struct ArrowArray* dictionary;
+
+  // Release callback
+  void (*release)(struct ArrowArray*);
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+} // extern "C"
+
+#endif // ARROW_C_DATA_INTERFACE
+
+namespace units
+{
+namespace detail
+{
+
+template<typename FloatType>
+constexpr const char* arrowFormat()
+{
+  static_assert(
+      std::is_arithmetic<FloatType>::value and not std::is_same<FloatType, bool>::value and
+          not std::is_same<FloatType, long double>::value,
+      "Arrow columns carry float, double or integer representations only.");
+
+  return std::is_same<FloatType, double>::value  ? "g"
+         : std::is_same<FloatType, float>::value ? "f"
+         : sizeof(FloatType) == 8U               ? (std::is_signed<FloatType>::value ? "l" : "L")
+         : sizeof(FloatType) == 4U               ? (std::is_signed<FloatType>::value ? "i" : "I")
+         : sizeof(FloatType) == 2U               ? (std::is_signed<FloatType>::value ? "s" : "S")
+                                                 : (std::is_signed<FloatType>::value ? "c" : "C");
+}
+
+template<typename Ratio>
+std::string ratioText()
+{
+  return Ratio::den == 1 ? std::to_string(Ratio::num)
+                         : std::to_string(Ratio::num) + "/" + std::to_string(Ratio::den);
+}
+
+template<typename PhysicalUnits>
+std::string arrowDimensions()
+{
+  using Dimensions = typename PhysicalUnits::PhysicalDimensions;
+
+  return ratioText<typename Dimensions::L>() + "," + ratioText<typename Dimensions::M>() + "," +
+         ratioText<typename Dimensions::T>() + "," + ratioText<typename Dimensions::I>() + "," +
+         ratioText<typename Dimensions::K>() + "," + ratioText<typename Dimensions::N>() + "," +
+         ratioText<typename Dimensions::J>();
+}
+
+template<typename PhysicalUnits>
+std::string arrowScale()
+{
+  static_assert(
+      IsRatio<typename PhysicalUnits::Scale>::value,
+      "Arrow columns carry std::ratio scales only; this scale overflows std::intmax_t.");
+
+  return std::to_string(PhysicalUnits::Scale::num) + "/" +
+         std::to_string(PhysicalUnits::Scale::den);
+}
+
+constexpr const char* kArrowDimensionsKey = "units.dimensions";
+constexpr const char* kArrowScaleKey = "units.scale";
+
+inline void appendInt32(std::string& output, const std::int32_t value)
+{
+  output.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+inline std::int32_t readInt32(const char*& input)
+{
+  std::int32_t value;
+  std::memcpy(&value, input, sizeof(value));
+  input += sizeof(value);
+  return value;
+}
+
+inline void
+appendArrowMetadata(std::string& output, const char* const key, const std::string& value)
+{
+  const std::size_t keySize = std::strlen(key);
+  appendInt32(output, static_cast<std::int32_t>(keySize));
+  output.append(key, keySize);
+  appendInt32(output, static_cast<std::int32_t>(value.size()));
+  output += value;
+}
+
+/// Encodes the units of @tparam PhysicalUnits in the binary layout of ArrowSchema::metadata.
+template<typename PhysicalUnits>
+std::string encodeArrowMetadata()
+{
+  std::string output;
+  appendInt32(output, 2);
+  appendArrowMetadata(output, kArrowDimensionsKey, arrowDimensions<PhysicalUnits>());
+  appendArrowMetadata(output, kArrowScaleKey, arrowScale<PhysicalUnits>());
+  return output;
+}
+
+/// Value of @param key in ArrowSchema::metadata @param metadata, or an empty string.
+inline std::string findArrowMetadata(const char* metadata, const char* const key)
+{
+  if(metadata == nullptr)
+  {
+    return {};
+  }
+
+  const std::int32_t pairs = readInt32(metadata);
+
+  for(std::int32_t index = 0; index < pairs; ++index)
+  {
+    const std::int32_t keySize = readInt32(metadata);
+    const bool found = std::strlen(key) == static_cast<std::size_t>(keySize) and
+                       std::memcmp(metadata, key, static_cast<std::size_t>(keySize)) == 0;
+    metadata += keySize;
+
+    const std::int32_t valueSize = readInt32(metadata);
+
+    if(found)
+    {
+      return std::string(metadata, static_cast<std::size_t>(valueSize));
+    }
+
+    metadata += valueSize;
+  }
+
+  return {};
+}
+
+/// Storage behind an exported ArrowSchema.
+struct ArrowSchemaData
+{
+  std::string mName;
+  std::string mMetadata;
+};
+
+/// Storage behind an exported ArrowArray. The optional owner keeps the samples alive until the
+/// consumer releases the array.
+struct ArrowArrayData
+{
+  const void* mBuffers[2];
+  std::shared_ptr<const void> mOwner;
+};
+
+inline void releaseArrowSchema(ArrowSchema* const schema)
+{
+  delete static_cast<ArrowSchemaData*>(schema->private_data);
+  schema->release = nullptr;
+}
+
+inline void releaseArrowArray(ArrowArray* const array)
+{
+  delete static_cast<ArrowArrayData*>(array->private_data);
+  array->release = nullptr;
+}
+
+} // End of namespace detail.
+
+/// @brief  Exports @param size samples at @param data as an Arrow column without copying them.
+///         Both structures are initialised by this function and handed over to the consumer, which
+///         releases them through their release callbacks.
+///
+///         EG: exportArrowColumn(speeds.data(), speeds.size(), "speed", &schema, &array);
+///
+/// @tparam Quantity    Affine quantity with a std::ratio scale and an arithmetic representation.
+/// @param  data        Samples; must outlive the release of @param array unless @param owner
+///                     keeps them alive.
+/// @param  size
+/// @param  name        Field name of the column.
+/// @param  schema      Uninitialised schema to export into.
+/// @param  array       Uninitialised array to export into.
+/// @param  owner       Optional owner of the samples, released together with @param array.
+template<typename Quantity>
+void exportArrowColumn(
+    const Quantity* const data,
+    const std::size_t size,
+    const std::string& name,
+    ArrowSchema* const schema,
+    ArrowArray* const array,
+    std::shared_ptr<const void> owner = nullptr)
+{
+  using PhysicalUnits = typename Quantity::PhysicalUnits;
+  using FloatType = typename Quantity::FloatType;
+
+  static_assert(
+      std::is_trivially_copyable<Quantity>::value and sizeof(Quantity) == sizeof(FloatType),
+      "Arrow columns require quantities laid out as their representation.");
+
+  std::unique_ptr<detail::ArrowSchemaData> schemaData(new detail::ArrowSchemaData{
+      name,
+      detail::encodeArrowMetadata<PhysicalUnits>() });
+
+  std::unique_ptr<detail::ArrowArrayData> arrayData(
+      new detail::ArrowArrayData{ { nullptr, data }, std::move(owner) });
+
+  *schema = ArrowSchema{ detail::arrowFormat<FloatType>(),
+                         schemaData->mName.c_str(),
+                         schemaData->mMetadata.c_str(),
+                         0,
+                         0,
+                         nullptr,
+                         nullptr,
+                         &detail::releaseArrowSchema,
+                         schemaData.get() };
+
+  *array = ArrowArray{ static_cast<int64_t>(size),
+                       0,
+                       0,
+                       2,
+                       0,
+                       arrayData->mBuffers,
+                       nullptr,
+                       nullptr,
+                       &detail::releaseArrowArray,
+                       arrayData.get() };
+
+  schemaData.release();
+  arrayData.release();
+}
+
+/// @brief  Arrow column imported as a span of @tparam Quantity. Takes ownership of the schema and
+///         array on construction, validates the format and the units once and releases both on
+///         destruction. Samples are read in place.
+///
+///         EG: ImportedArrowColumn<Metres> heights(&schema, &array);
+///             for(const Metres height: heights.span()) { ... }
+///
+/// @tparam Quantity    Must match the exported quantity exactly: same dimensions, same scale and
+///                     same representation.
+template<typename Quantity>
+class ImportedArrowColumn
+{
+public:
+  using SelfType = ImportedArrowColumn<Quantity>;
+  using PhysicalUnits = typename Quantity::PhysicalUnits;
+  using FloatType = typename Quantity::FloatType;
+
+  static_assert(
+      std::is_trivially_copyable<Quantity>::value and sizeof(Quantity) == sizeof(FloatType),
+      "Arrow columns require quantities laid out as their representation.");
+
+  /// @brief  Moves @param schema and @param array into the column, leaving them released, and
+  ///         validates them. Throws std::runtime_error, after releasing both, if the column is not
+  ///         a null-free primitive array of @tparam Quantity.
+  /// @param  schema
+  /// @param  array
+  ImportedArrowColumn(ArrowSchema* const schema, ArrowArray* const array):
+      mSchema(*schema),
+      mArray(*array)
+  {
+    schema->release = nullptr;
+    array->release = nullptr;
+
+    try
+    {
+      validate();
+    }
+    catch(...)
+    {
+      release();
+      throw;
+    }
+  }
+
+  ImportedArrowColumn(const ImportedArrowColumn&) = delete;
+
+  ImportedArrowColumn(ImportedArrowColumn&&) = delete;
+
+  ~ImportedArrowColumn()
+  {
+    release();
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+  /// @brief  Samples of the column.
+  /// @return
+  QuantitySpan<const Quantity> span() const noexcept(true)
+  {
+    return QuantitySpan<const Quantity>(
+        static_cast<const Quantity*>(mArray.buffers[1]) + mArray.offset,
+        static_cast<std::size_t>(mArray.length));
+  }
+
+  /// @brief  Field name of the column.
+  /// @return
+  const char* name() const noexcept(true)
+  {
+    return mSchema.name == nullptr ? "" : mSchema.name;
+  }
+
+private:
+  void validate() const
+  {
+    if(mSchema.release == nullptr or mArray.release == nullptr)
+    {
+      throw std::runtime_error("Arrow column has already been released.");
+    }
+
+    // A producer is not bound to fill in the format or the buffers; reject rather than read them.
+    if(mSchema.format == nullptr or mArray.buffers == nullptr or
+       std::strcmp(mSchema.format, detail::arrowFormat<FloatType>()) != 0 or
+       mSchema.n_children != 0 or mArray.n_buffers != 2)
+    {
+      throw std::runtime_error("Arrow column is not a primitive array of the requested type.");
+    }
+
+    // span() offsets into the data buffer, which a producer may only omit for an empty array.
+    if(mArray.length < 0 or mArray.offset < 0 or
+       (mArray.buffers[1] == nullptr and (mArray.length > 0 or mArray.offset > 0)))
+    {
+      throw std::runtime_error("Arrow column has a negative extent or no data buffer.");
+    }
+
+    if(mArray.null_count != 0 and mArray.buffers[0] != nullptr)
+    {
+      throw std::runtime_error("Arrow column holds nulls, which quantities cannot represent.");
+    }
+
+    if(detail::findArrowMetadata(mSchema.metadata, detail::kArrowDimensionsKey) !=
+           detail::arrowDimensions<PhysicalUnits>() or
+       detail::findArrowMetadata(mSchema.metadata, detail::kArrowScaleKey) !=
+           detail::arrowScale<PhysicalUnits>())
+    {
+      throw std::runtime_error("Arrow column carries different physical units than requested.");
+    }
+  }
+
+  void release() noexcept(true)
+  {
+    if(mArray.release != nullptr)
+    {
+      mArray.release(&mArray);
+    }
+
+    if(mSchema.release != nullptr)
+    {
+      mSchema.release(&mSchema);
+    }
+  }
+
+  ArrowSchema mSchema;
+  ArrowArray mArray;
+};
+
+} // End of namespace units.
\ No newline at end of file
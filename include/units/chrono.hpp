@@ -0,0 +1,135 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <chrono>
+
+namespace units
+{
+
+/// @brief  Affine quantity of time whose scale is the period of std::chrono::duration<Rep, Period>.
+///         Both types store the same tick count, so conversions between the two are free and keep
+///         integer ticks exact. Conversions between integer durations of different periods
+///         truncate like std::chrono::duration_cast, and comparisons across periods are exact.
+///
+///         EG: DurationQuantity<std::int64_t, std::nano> holds the count of a
+///             std::chrono::nanoseconds.
+template<typename Rep, typename Period>
+using DurationQuantity = AffineQuantity<PhysicalUnits<Time, Period>, Rep>;
+
+namespace detail
+{
+
+template<typename Quantity>
+struct ChronoCompatible
+{
+  static constexpr bool value =
+      std::is_same<Time, typename Quantity::PhysicalUnits::PhysicalDimensions>::value and
+      IsRatio<typename Quantity::PhysicalUnits::Scale>::value;
+};
+
+} // End of namespace detail.
+
+/// @brief  Wraps a duration into the affine quantity of the same tick count and period. No
+///         conversion is performed.
+/// @tparam Rep
+/// @tparam Period
+/// @param  duration
+/// @return
+template<typename Rep, typename Period>
+constexpr DurationQuantity<Rep, Period> fromDuration(
+    const std::chrono::duration<Rep, Period> duration) noexcept(true)
+{
+  return DurationQuantity<Rep, Period>(duration.count());
+}
+
+/// @brief  Converts a duration into an affine quantity of time @tparam Quantity. The conversion
+///         follows std::chrono::duration_cast, i.e. it is a no-op if the periods and the
+///         representations match and is carried out in integer arithmetic for integer ticks.
+///
+///         EG: fromDuration<Seconds>(std::chrono::nanoseconds(1500)) == Seconds(1.5e-6)
+///
+/// @tparam Quantity    Affine quantity of time whose scale is a std::ratio.
+/// @tparam Rep
+/// @tparam Period
+/// @param  duration
+/// @return
+template<typename Quantity, typename Rep, typename Period>
+constexpr Quantity fromDuration(const std::chrono::duration<Rep, Period> duration) noexcept(true)
+{
+  static_assert(
+      detail::ChronoCompatible<Quantity>::value,
+      "Invalid request to convert a duration into a quantity that is not a time with a std::ratio "
+      "scale.");
+
+  using Target = std::chrono::
+      duration<typename Quantity::FloatType, typename Quantity::PhysicalUnits::Scale>;
+
+  return Quantity(std::chrono::duration_cast<Target>(duration).count());
+}
+
+/// @brief  Wraps an affine quantity of time into the duration of the same tick count and period.
+///         No conversion is performed.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  quantity
+/// @return
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr std::chrono::duration<FloatType, typename PhysicalUnits::Scale> toDuration(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> quantity) noexcept(true)
+{
+  static_assert(
+      detail::ChronoCompatible<AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>>::value,
+      "Invalid request to convert a quantity that is not a time with a std::ratio scale into a "
+      "duration.");
+
+  return std::chrono::duration<FloatType, typename PhysicalUnits::Scale>(quantity.scalar());
+}
+
+/// @brief  Converts an affine quantity of time into the duration @tparam Duration. The conversion
+///         follows std::chrono::duration_cast, i.e. it is a no-op if the periods and the
+///         representations match and is carried out in integer arithmetic for integer ticks.
+///
+///         EG: toDuration<std::chrono::nanoseconds>(Seconds(1.5)).count() == 1500000000
+///
+/// @tparam Duration    Specialization of std::chrono::duration.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  quantity
+/// @return
+template<
+    typename Duration,
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy>
+constexpr Duration toDuration(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> quantity) noexcept(true)
+{
+  return std::chrono::duration_cast<Duration>(toDuration(quantity));
+}
+
+} // End of namespace units.
\ No newline at end of file
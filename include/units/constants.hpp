@@ -0,0 +1,186 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include "si.hpp"
+
+/// Physical constants as typed quantities.
+///
+/// Constants that are exact by definition of the S.I. (2019) are carried entirely in the scale of
+/// their physical units and have a magnitude of one. Multiplying by one of them therefore adds no
+/// runtime arithmetic: with the PreserveScalePolicy the product lands in units whose scale already
+/// holds the constant, and any later conversion is a single compile-time PhysicalUnitsScale factor.
+///
+///     EG: constants::kSpeedOfLight * Seconds(2.0) is AffineQuantity<LightSecondsPhysicalUnit>(2.0)
+///         and converts to Metres with the one factor 299792458.
+///
+/// Measured constants are CODATA 2018 recommended values held as magnitudes in coherent S.I. units.
+///
+/// Scales that do not fit a std::ratio, e.g. the 10^-34 of the Planck constant, are held as a
+/// FactoredScale. Constants for representations other than double are spelled
+/// AffineQuantity<XPhysicalUnit, F>(F(1)) for exact constants.
+
+namespace units
+{
+namespace constants
+{
+namespace detail
+{
+
+/// Physical dimensions with integral exponents of L, M, T, I, Θ, N and J.
+template<
+    std::intmax_t L,
+    std::intmax_t M,
+    std::intmax_t T,
+    std::intmax_t I = 0,
+    std::intmax_t K = 0,
+    std::intmax_t N = 0,
+    std::intmax_t J = 0>
+using IntegralDimensions = PhysicalDimensions<
+    std::ratio<L>,
+    std::ratio<M>,
+    std::ratio<T>,
+    std::ratio<I>,
+    std::ratio<K>,
+    std::ratio<N>,
+    std::ratio<J>>;
+
+/// Exact scale Mantissa × 10^Exponent. Exponent must not be zero.
+template<std::intmax_t Mantissa, std::intmax_t Exponent>
+using DecimalScale = typename MultiplyScales<
+    std::ratio<Mantissa>,
+    FactoredScale<PrimePower<2, Exponent>, PrimePower<5, Exponent>>>::Result;
+
+} // End of namespace detail.
+
+/// Speed of light in vacuum, c = 299 792 458 m s⁻¹ (exact).
+using SpeedOfLightPhysicalUnit = PhysicalUnits<Speed, std::ratio<299792458>>;
+
+/// Planck constant, h = 6.626 070 15 × 10⁻³⁴ J s (exact).
+using PlanckConstantPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<2, 1, -1>, detail::DecimalScale<662607015, -42>>;
+
+/// Elementary charge, e = 1.602 176 634 × 10⁻¹⁹ C (exact).
+using ElementaryChargePhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<0, 0, 1, 1>, detail::DecimalScale<1602176634, -28>>;
+
+/// Boltzmann constant, k = 1.380 649 × 10⁻²³ J K⁻¹ (exact).
+using BoltzmannConstantPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<2, 1, -2, 0, -1>, detail::DecimalScale<1380649, -29>>;
+
+/// Avogadro constant, N_A = 6.022 140 76 × 10²³ mol⁻¹ (exact).
+using AvogadroConstantPhysicalUnit = PhysicalUnits<
+    detail::IntegralDimensions<0, 0, 0, 0, 0, -1>,
+    detail::DecimalScale<602214076, 15>>;
+
+/// Molar gas constant, R = N_A k ≈ 8.314 462 618 J mol⁻¹ K⁻¹ (exact).
+using MolarGasConstantPhysicalUnit = MultiplyPhysicalUnits<
+    AvogadroConstantPhysicalUnit,
+    BoltzmannConstantPhysicalUnit,
+    PreserveScalePolicy>::Result;
+
+/// Faraday constant, F = N_A e ≈ 96 485.332 12 C mol⁻¹ (exact).
+using FaradayConstantPhysicalUnit = MultiplyPhysicalUnits<
+    AvogadroConstantPhysicalUnit,
+    ElementaryChargePhysicalUnit,
+    PreserveScalePolicy>::Result;
+
+/// Hyperfine transition frequency of caesium-133, Δν_Cs = 9 192 631 770 Hz (exact).
+using CaesiumFrequencyPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<0, 0, -1>, std::ratio<9192631770>>;
+
+/// Luminous efficacy of 540 THz radiation, K_cd = 683 lm W⁻¹ (exact).
+using LuminousEfficacyPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<-2, -1, 3, 0, 0, 0, 1>, std::ratio<683>>;
+
+/// Standard acceleration of gravity, g_n = 9.806 65 m s⁻² (exact by convention).
+using StandardGravityPhysicalUnit = PhysicalUnits<Acceleration, std::ratio<980665, 100000>>;
+
+/// Standard atmosphere, 101 325 Pa (exact by convention).
+using StandardAtmospherePhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<-1, 1, -2>, std::ratio<101325>>;
+
+constexpr AffineQuantity<SpeedOfLightPhysicalUnit, double> kSpeedOfLight{ 1.0 };
+constexpr AffineQuantity<PlanckConstantPhysicalUnit, double> kPlanckConstant{ 1.0 };
+constexpr AffineQuantity<ElementaryChargePhysicalUnit, double> kElementaryCharge{ 1.0 };
+constexpr AffineQuantity<BoltzmannConstantPhysicalUnit, double> kBoltzmannConstant{ 1.0 };
+constexpr AffineQuantity<AvogadroConstantPhysicalUnit, double> kAvogadroConstant{ 1.0 };
+constexpr AffineQuantity<MolarGasConstantPhysicalUnit, double> kMolarGasConstant{ 1.0 };
+constexpr AffineQuantity<FaradayConstantPhysicalUnit, double> kFaradayConstant{ 1.0 };
+constexpr AffineQuantity<CaesiumFrequencyPhysicalUnit, double> kCaesiumFrequency{ 1.0 };
+constexpr AffineQuantity<LuminousEfficacyPhysicalUnit, double> kLuminousEfficacy{ 1.0 };
+constexpr AffineQuantity<StandardGravityPhysicalUnit, double> kStandardGravity{ 1.0 };
+constexpr AffineQuantity<StandardAtmospherePhysicalUnit, double> kStandardAtmosphere{ 1.0 };
+
+/// Newtonian constant of gravitation, G in m³ kg⁻¹ s⁻² (CODATA 2018).
+using GravitationalConstantPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<3, -1, -2>, std::ratio<1>>;
+
+/// Fine-structure constant, α (CODATA 2018). Dimensionless.
+using FineStructureConstantPhysicalUnit = PhysicalUnits<PhysicalDimensions<>, std::ratio<1>>;
+
+/// Vacuum magnetic permeability, μ₀ in N A⁻² (CODATA 2018).
+using VacuumMagneticPermeabilityPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<1, 1, -2, -2>, std::ratio<1>>;
+
+/// Vacuum electric permittivity, ε₀ in F m⁻¹ (CODATA 2018).
+using VacuumElectricPermittivityPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<-3, -1, 4, 2>, std::ratio<1>>;
+
+/// Stefan-Boltzmann constant, σ in W m⁻² K⁻⁴. Exact in the S.I. but irrational through π⁵, so
+/// it is held as its CODATA 2018 magnitude.
+using StefanBoltzmannConstantPhysicalUnit =
+    PhysicalUnits<detail::IntegralDimensions<0, 1, -3, 0, -4>, std::ratio<1>>;
+
+constexpr AffineQuantity<GravitationalConstantPhysicalUnit, double> kGravitationalConstant{
+  6.67430e-11
+};
+
+/// Electron mass, m_e (CODATA 2018).
+constexpr AffineQuantity<KilogramsPhysicalUnit, double> kElectronMass{ 9.1093837015e-31 };
+
+/// Proton mass, m_p (CODATA 2018).
+constexpr AffineQuantity<KilogramsPhysicalUnit, double> kProtonMass{ 1.67262192369e-27 };
+
+constexpr AffineQuantity<FineStructureConstantPhysicalUnit, double> kFineStructureConstant{
+  7.2973525693e-3
+};
+constexpr AffineQuantity<VacuumMagneticPermeabilityPhysicalUnit, double>
+    kVacuumMagneticPermeability{ 1.25663706212e-6 };
+constexpr AffineQuantity<VacuumElectricPermittivityPhysicalUnit, double>
+    kVacuumElectricPermittivity{ 8.8541878128e-12 };
+constexpr AffineQuantity<StefanBoltzmannConstantPhysicalUnit, double> kStefanBoltzmannConstant{
+  5.670374419e-8
+};
+
+} // End of namespace constants.
+
+/// Physical units of length travelled by light in vacuum in one second.
+using LightSecondsPhysicalUnit = PhysicalUnits<Length, std::ratio<299792458>>;
+
+/// Light-seconds
+using LightSeconds = AffineQuantity<LightSecondsPhysicalUnit, double>;
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,294 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/// Opt-in instrumentation that counts every runtime unit conversion per (From, To) pair of physical
+/// units and per call site. Enabled by defining UNITS_CONVERSION_AUDIT for the whole program, which
+/// requires C++20 for std::source_location. Without the macro this header only defines the two
+/// empty hooks below and the library compiles exactly as before.
+///
+/// The mixed-unit operators convert their right-hand operand as it binds to the parameter, so
+/// those conversions are attributed to the expression applying the operator. multiply<>() and
+/// divide<>() record the rescale folded in by their scale policy at their call site. operator*
+/// and operator/ cannot capture a site, so the rescale of CanonicalScalePolicy behind them is
+/// attributed to the operator in affineQuantity.hpp; call multiply<>() or divide<>() to locate it.
+
+#if defined(UNITS_CONVERSION_AUDIT)
+
+#if __cplusplus < 202002L
+#error "UNITS_CONVERSION_AUDIT requires C++20 for std::source_location."
+#endif
+
+#include "scale.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <source_location>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+/// Trailing parameter of the converting constructor of @class AffineQuantity capturing the site
+/// of the conversion.
+#define UNITS_CONVERSION_AUDIT_PARAMETER                                                         \
+  , const std::source_location conversionSite = std::source_location::current()
+
+/// Records a conversion from @param FROM to @param TO at the captured site.
+#define UNITS_CONVERSION_AUDIT_RECORD(FROM, TO)                                                  \
+  ::units::audit::record<FROM, TO>(conversionSite)
+
+namespace units
+{
+namespace audit
+{
+
+/// @brief  Number of conversions counted at a site.
+struct ConversionCount
+{
+  /// Physical units converted from and to, as spelled by the compiler.
+  const char* from;
+  const char* to;
+
+  /// Call site of the conversion.
+  const char* file;
+  const char* function;
+  std::uint_least32_t line;
+  std::uint_least32_t column;
+
+  std::uint64_t count;
+};
+
+namespace detail
+{
+
+template<typename Type>
+constexpr const char* typeName() noexcept(true)
+{
+  return std::source_location::current().function_name();
+}
+
+/// Pointers are compared by value on the hot path. Identical strings at different addresses, e.g.
+/// from different translation units, are folded together in @fn report().
+struct SiteKey
+{
+  const char* from;
+  const char* to;
+  const char* file;
+  const char* function;
+  std::uint_least32_t line;
+  std::uint_least32_t column;
+
+  bool operator==(const SiteKey&) const = default;
+};
+
+struct SiteKeyHash
+{
+  std::size_t operator()(const SiteKey& key) const noexcept(true)
+  {
+    std::size_t seed = std::hash<const void*>()(key.from);
+    for(const std::size_t value:
+        { std::hash<const void*>()(key.to),
+          std::hash<const void*>()(key.file),
+          std::hash<const void*>()(key.function),
+          std::size_t(key.line),
+          std::size_t(key.column) })
+    {
+      seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U);
+    }
+
+    return seed;
+  }
+};
+
+using Counters = std::unordered_map<SiteKey, std::uint64_t, SiteKeyHash>;
+
+/// Counts flushed from all threads.
+class Registry
+{
+public:
+  static Registry& instance()
+  {
+    static Registry registry;
+    return registry;
+  }
+
+  void merge(Counters& counters)
+  {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    for(const auto& [key, count]: counters)
+    {
+      mCounters[key] += count;
+    }
+  }
+
+  Counters snapshot()
+  {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    return mCounters;
+  }
+
+  void clear()
+  {
+    const std::lock_guard<std::mutex> lock(mMutex);
+    mCounters.clear();
+  }
+
+private:
+  std::mutex mMutex;
+  Counters mCounters;
+};
+
+/// Counts of the calling thread. Flushed into the registry on request and on thread exit.
+class ThreadCounters
+{
+public:
+  static ThreadCounters& instance()
+  {
+    thread_local ThreadCounters counters;
+    return counters;
+  }
+
+  ThreadCounters(): mRegistry(Registry::instance()) {}
+
+  ThreadCounters(const ThreadCounters&) = delete;
+
+  ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+  ~ThreadCounters()
+  {
+    flush();
+  }
+
+  void increment(const SiteKey& key)
+  {
+    ++mCounters[key];
+  }
+
+  void flush()
+  {
+    mRegistry.merge(mCounters);
+    mCounters.clear();
+  }
+
+private:
+  Registry& mRegistry;
+  Counters mCounters;
+};
+
+} // End of namespace detail.
+
+/// @brief  Counts one conversion from @tparam From to @tparam To at @param site into the counters
+///         of the calling thread. Conversions of unit scale and constant evaluation are not
+///         counted.
+/// @tparam From    Physical units converted from.
+/// @tparam To      Physical units converted to.
+/// @param  site
+template<typename From, typename To>
+constexpr void record(const std::source_location& site) noexcept(true)
+{
+  if constexpr(not std::is_same_v<
+                   typename DivideScales<typename From::Scale, typename To::Scale>::Result,
+                   std::ratio<1>>)
+  {
+    if(not std::is_constant_evaluated())
+    {
+      detail::ThreadCounters::instance().increment(detail::SiteKey{
+          detail::typeName<From>(),
+          detail::typeName<To>(),
+          site.file_name(),
+          site.function_name(),
+          site.line(),
+          site.column() });
+    }
+  }
+}
+
+/// @brief  Flushes the counters of the calling thread into the process-wide registry. Threads
+///         flush automatically on exit.
+inline void flush()
+{
+  detail::ThreadCounters::instance().flush();
+}
+
+/// @brief  Flushes the counters of the calling thread and reports the counts of every site
+///         flushed so far, sorted by decreasing count.
+/// @return
+inline std::vector<ConversionCount> report()
+{
+  flush();
+
+  std::vector<ConversionCount> result;
+  for(const auto& [key, count]: detail::Registry::instance().snapshot())
+  {
+    const auto match = std::find_if(
+        result.begin(),
+        result.end(),
+        [&key](const ConversionCount& entry)
+        {
+          return entry.line == key.line and entry.column == key.column and
+                 std::strcmp(entry.from, key.from) == 0 and std::strcmp(entry.to, key.to) == 0 and
+                 std::strcmp(entry.file, key.file) == 0 and
+                 std::strcmp(entry.function, key.function) == 0;
+        });
+
+    if(match == result.end())
+    {
+      result.push_back(
+          ConversionCount{ key.from, key.to, key.file, key.function, key.line, key.column, count });
+    }
+    else
+    {
+      match->count += count;
+    }
+  }
+
+  std::sort(
+      result.begin(),
+      result.end(),
+      [](const ConversionCount& lhs, const ConversionCount& rhs)
+      {
+        return lhs.count > rhs.count;
+      });
+
+  return result;
+}
+
+/// @brief  Discards the counters of the calling thread and every count flushed so far.
+inline void reset()
+{
+  flush();
+  detail::Registry::instance().clear();
+}
+
+} // End of namespace audit.
+} // End of namespace units.
+
+#else
+
+#define UNITS_CONVERSION_AUDIT_PARAMETER
+#define UNITS_CONVERSION_AUDIT_RECORD(FROM, TO)
+
+#endif
\ No newline at end of file
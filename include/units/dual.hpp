@@ -0,0 +1,365 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cmath>
+#include <cstddef>
+
+/// Dual numbers for forward-mode differentiation through affine quantities. Dual<F, N> holds a
+/// value and its N partial derivatives, and is used as the representation of a quantity:
+///
+///     using DualMetres = AffineQuantity<MetresPhysicalUnit, Dual<double, 2>>;
+///
+/// Conversions, products and quotients keep their units, and the partial derivative of a result
+/// with respect to a seeded input is itself a quantity in the units of their quotient. The
+/// derivatives are a fixed-size array updated by plain loops over N, which compilers vectorise.
+
+namespace units
+{
+
+/// @brief  Dual number with a value of type @tparam FloatType_ and @tparam N_ derivatives.
+///
+/// @tparam FloatType_  Scalar floating point type. Exposed as value_type so that
+///                     RepresentationTraits treat it as the scalar lane of the dual number.
+/// @tparam N_          Number of independent variables differentiated against.
+template<typename FloatType_, std::size_t N_>
+class Dual
+{
+public:
+  using value_type = FloatType_; // NOLINT(readability-identifier-naming)
+  using FloatType = FloatType_;
+  using SelfType = Dual<FloatType, N_>;
+
+  static constexpr std::size_t kSize = N_;
+
+  static_assert(kSize > 0U, "Dual numbers require at least one derivative.");
+
+  /// @brief  Default constructor with 0 initialization.
+  constexpr Dual() noexcept(true): mValue(0), mDerivatives{} {}
+
+  /// @brief  Construction of a constant i.e. with zero derivatives.
+  /// @param  value
+  constexpr Dual(const FloatType value) noexcept(true): // NOLINT(google-explicit-constructor)
+      mValue(value),
+      mDerivatives{}
+  {
+  }
+
+  /// @brief  Construction of independent variable @param index with value @param value.
+  /// @param  value
+  /// @param  index
+  /// @return
+  static constexpr SelfType variable(const FloatType value, const std::size_t index) noexcept(true)
+  {
+    SelfType result(value);
+    result.mDerivatives[index] = FloatType(1);
+    return result;
+  }
+
+  constexpr FloatType value() const noexcept(true)
+  {
+    return mValue;
+  }
+
+  constexpr FloatType derivative(const std::size_t index) const noexcept(true)
+  {
+    return mDerivatives[index];
+  }
+
+  constexpr SelfType operator-() const noexcept(true)
+  {
+    return scaled(FloatType(-1), -mValue);
+  }
+
+  constexpr SelfType& operator+=(const SelfType& rhs) noexcept(true)
+  {
+    mValue += rhs.mValue;
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      mDerivatives[index] += rhs.mDerivatives[index];
+    }
+
+    return *this;
+  }
+
+  constexpr SelfType& operator-=(const SelfType& rhs) noexcept(true)
+  {
+    mValue -= rhs.mValue;
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      mDerivatives[index] -= rhs.mDerivatives[index];
+    }
+
+    return *this;
+  }
+
+  constexpr SelfType& operator*=(const SelfType& rhs) noexcept(true)
+  {
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      mDerivatives[index] = mDerivatives[index] * rhs.mValue + mValue * rhs.mDerivatives[index];
+    }
+
+    mValue *= rhs.mValue;
+    return *this;
+  }
+
+  constexpr SelfType& operator/=(const SelfType& rhs) noexcept(true)
+  {
+    const FloatType inverse = FloatType(1) / rhs.mValue;
+    const FloatType quotient = mValue * inverse;
+
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      mDerivatives[index] = (mDerivatives[index] - quotient * rhs.mDerivatives[index]) * inverse;
+    }
+
+    mValue = quotient;
+    return *this;
+  }
+
+  constexpr SelfType& operator*=(const FloatType rhs) noexcept(true)
+  {
+    *this = scaled(rhs, mValue * rhs);
+    return *this;
+  }
+
+  constexpr SelfType& operator/=(const FloatType rhs) noexcept(true)
+  {
+    *this = scaled(FloatType(1) / rhs, mValue / rhs);
+    return *this;
+  }
+
+  /// @brief  Dual number with value @param value and the derivatives scaled by @param factor,
+  ///         i.e. the chain rule for a function of derivative factor at this point.
+  /// @param  factor
+  /// @param  value
+  /// @return
+  constexpr SelfType scaled(const FloatType factor, const FloatType value) const noexcept(true)
+  {
+    SelfType result(value);
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      result.mDerivatives[index] = factor * mDerivatives[index];
+    }
+
+    return result;
+  }
+
+private:
+  FloatType mValue;
+  FloatType mDerivatives[kSize];
+};
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator+(Dual<FloatType, N> lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs += rhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator-(Dual<FloatType, N> lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs -= rhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator*(Dual<FloatType, N> lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs *= rhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator/(Dual<FloatType, N> lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs /= rhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator*(Dual<FloatType, N> lhs, const FloatType rhs)
+{
+  return lhs *= rhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator*(const FloatType lhs, Dual<FloatType, N> rhs)
+{
+  return rhs *= lhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator/(Dual<FloatType, N> lhs, const FloatType rhs)
+{
+  return lhs /= rhs;
+}
+
+template<typename FloatType, std::size_t N>
+constexpr Dual<FloatType, N> operator/(const FloatType lhs, const Dual<FloatType, N>& rhs)
+{
+  return Dual<FloatType, N>(lhs) /= rhs;
+}
+
+/// Comparisons order dual numbers by value.
+template<typename FloatType, std::size_t N>
+constexpr bool operator==(const Dual<FloatType, N>& lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs.value() == rhs.value();
+}
+
+template<typename FloatType, std::size_t N>
+constexpr bool operator!=(const Dual<FloatType, N>& lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs.value() != rhs.value();
+}
+
+template<typename FloatType, std::size_t N>
+constexpr bool operator<(const Dual<FloatType, N>& lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs.value() < rhs.value();
+}
+
+template<typename FloatType, std::size_t N>
+constexpr bool operator<=(const Dual<FloatType, N>& lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs.value() <= rhs.value();
+}
+
+template<typename FloatType, std::size_t N>
+constexpr bool operator>(const Dual<FloatType, N>& lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs.value() > rhs.value();
+}
+
+template<typename FloatType, std::size_t N>
+constexpr bool operator>=(const Dual<FloatType, N>& lhs, const Dual<FloatType, N>& rhs)
+{
+  return lhs.value() >= rhs.value();
+}
+
+template<typename FloatType, std::size_t N>
+Dual<FloatType, N> sqrt(const Dual<FloatType, N>& dual)
+{
+  const FloatType root = std::sqrt(dual.value());
+  return dual.scaled(FloatType(0.5) / root, root);
+}
+
+template<typename FloatType, std::size_t N>
+Dual<FloatType, N> exp(const Dual<FloatType, N>& dual)
+{
+  const FloatType exponential = std::exp(dual.value());
+  return dual.scaled(exponential, exponential);
+}
+
+template<typename FloatType, std::size_t N>
+Dual<FloatType, N> log(const Dual<FloatType, N>& dual)
+{
+  return dual.scaled(FloatType(1) / dual.value(), std::log(dual.value()));
+}
+
+template<typename FloatType, std::size_t N>
+Dual<FloatType, N> sin(const Dual<FloatType, N>& dual)
+{
+  return dual.scaled(std::cos(dual.value()), std::sin(dual.value()));
+}
+
+template<typename FloatType, std::size_t N>
+Dual<FloatType, N> cos(const Dual<FloatType, N>& dual)
+{
+  return dual.scaled(-std::sin(dual.value()), std::cos(dual.value()));
+}
+
+template<typename FloatType, std::size_t N>
+Dual<FloatType, N> pow(const Dual<FloatType, N>& dual, const FloatType exponent)
+{
+  // x^(n - 1) rather than x^n / x, which is 0 / 0 at the origin. x^0 is constant everywhere.
+  const FloatType slope = exponent == FloatType(0)
+                              ? FloatType(0)
+                              : exponent * std::pow(dual.value(), exponent - FloatType(1));
+
+  return dual.scaled(slope, std::pow(dual.value(), exponent));
+}
+
+/// @brief  Seeds @param quantity as independent variable @param index of @tparam N.
+///
+///         EG: const auto length = seedVariable<2>(Metres(3.0), 0);
+///
+/// @tparam N
+/// @param  quantity
+/// @param  index
+/// @return
+template<std::size_t N, typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+constexpr AffineQuantity<PhysicalUnits, Dual<FloatType, N>, ConversionPolicy> seedVariable(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> quantity,
+    const std::size_t index) noexcept(true)
+{
+  return AffineQuantity<PhysicalUnits, Dual<FloatType, N>, ConversionPolicy>(
+      Dual<FloatType, N>::variable(quantity.scalar(), index));
+}
+
+/// @brief  Value of a dual-valued @param quantity, in its units.
+/// @param  quantity
+/// @return
+template<typename PhysicalUnits, typename FloatType, std::size_t N, typename ConversionPolicy>
+constexpr AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> primal(
+    const AffineQuantity<PhysicalUnits, Dual<FloatType, N>, ConversionPolicy>
+        quantity) noexcept(true)
+{
+  return AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>(quantity.scalar().value());
+}
+
+/// @brief  Partial derivative of a dual-valued @param quantity with respect to variable
+///         @param index, seeded as a quantity of type @tparam Variable. The result is expressed
+///         in the units of the quotient of the two, e.g. metres per second for a distance
+///         differentiated against a duration.
+/// @tparam Variable    Quantity type the variable was seeded from.
+/// @param  quantity
+/// @param  index
+/// @return
+template<
+    typename Variable,
+    typename PhysicalUnits,
+    typename FloatType,
+    std::size_t N,
+    typename ConversionPolicy>
+constexpr AffineQuantity<
+    typename DividePhysicalUnits<
+        PhysicalUnits,
+        typename Variable::PhysicalUnits,
+        PreserveScalePolicy>::Result,
+    FloatType,
+    ConversionPolicy>
+partial(
+    const AffineQuantity<PhysicalUnits, Dual<FloatType, N>, ConversionPolicy> quantity,
+    const std::size_t index) noexcept(true)
+{
+  using Units = typename DividePhysicalUnits<
+      PhysicalUnits,
+      typename Variable::PhysicalUnits,
+      PreserveScalePolicy>::Result;
+
+  return AffineQuantity<Units, FloatType, ConversionPolicy>(quantity.scalar().derivative(index));
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,590 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/// Batch predicates over columns of quantities. Each predicate converts its threshold once into
+/// the physical units of the column, compares every element against the raw magnitude and writes
+/// one bit per element into packed 64-bit words, element i landing in bit i % 64 of word i / 64.
+/// Bits past the end of the column are cleared. The results are identical to applying the
+/// mixed-unit comparison operators of affineQuantity.hpp element by element; integral columns
+/// compare against the ceiling or the floor of a threshold they cannot represent exactly.
+
+namespace units
+{
+
+/// Word of a packed bitmask.
+using BitmaskWord = std::uint64_t;
+
+/// @brief  Number of words of the bitmask of a column of @param size elements.
+/// @param  size
+/// @return
+constexpr std::size_t bitmaskWords(const std::size_t size) noexcept(true)
+{
+  return (size + 63U) / 64U;
+}
+
+namespace detail
+{
+
+inline unsigned countTrailingZeros(const BitmaskWord word) noexcept(true)
+{
+#if defined(__GNUC__)
+  return unsigned(__builtin_ctzll(word));
+#else
+  unsigned count = 0;
+  for(BitmaskWord bits = word; (bits & 1U) == 0U; bits >>= 1U)
+  {
+    ++count;
+  }
+
+  return count;
+#endif
+}
+
+inline std::size_t populationCount(const BitmaskWord word) noexcept(true)
+{
+#if defined(__GNUC__)
+  return std::size_t(__builtin_popcountll(word));
+#else
+  std::size_t count = 0;
+  for(BitmaskWord bits = word; bits != 0U; bits &= bits - 1U)
+  {
+    ++count;
+  }
+
+  return count;
+#endif
+}
+
+/// Rounding of a threshold that an integral column cannot represent exactly. Comparing against the
+/// ceiling or the floor of the exact threshold, whichever the comparison calls for, gives the same
+/// result as the mixed-unit operators, which weigh the truncated remainder.
+struct CeilingRounding
+{
+  static constexpr int apply(const int remainder) noexcept(true)
+  {
+    return remainder > 0 ? 1 : 0;
+  }
+};
+
+struct FloorRounding
+{
+  static constexpr int apply(const int remainder) noexcept(true)
+  {
+    return remainder < 0 ? -1 : 0;
+  }
+};
+
+/// Half-open range [lower, upper) of magnitudes.
+template<typename FloatType>
+struct Bounds
+{
+  FloatType lower;
+  FloatType upper;
+};
+
+struct LessComparison
+{
+  using Rounding = CeilingRounding;
+
+  template<typename FloatType>
+  static constexpr bool apply(const FloatType value, const FloatType threshold) noexcept(true)
+  {
+    return value < threshold;
+  }
+};
+
+struct LessEqualComparison
+{
+  using Rounding = FloorRounding;
+
+  template<typename FloatType>
+  static constexpr bool apply(const FloatType value, const FloatType threshold) noexcept(true)
+  {
+    return value <= threshold;
+  }
+};
+
+struct GreaterComparison
+{
+  using Rounding = FloorRounding;
+
+  template<typename FloatType>
+  static constexpr bool apply(const FloatType value, const FloatType threshold) noexcept(true)
+  {
+    return value > threshold;
+  }
+};
+
+struct GreaterEqualComparison
+{
+  using Rounding = CeilingRounding;
+
+  template<typename FloatType>
+  static constexpr bool apply(const FloatType value, const FloatType threshold) noexcept(true)
+  {
+    return value >= threshold;
+  }
+};
+
+struct RangeComparison
+{
+  using Rounding = CeilingRounding;
+
+  template<typename FloatType>
+  static constexpr bool apply(const FloatType value, const Bounds<FloatType> bounds) noexcept(
+      true)
+  {
+    return bounds.lower <= value and value < bounds.upper;
+  }
+};
+
+/// Scalar kernel over @param size elements starting at a word boundary of @param mask.
+template<typename Comparison, typename FloatType, typename Threshold>
+inline void scalarCompareKernel(
+    const FloatType* const values,
+    const std::size_t size,
+    const Threshold threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  for(std::size_t word = 0; word < bitmaskWords(size); ++word)
+  {
+    const std::size_t begin = word * 64U;
+    const std::size_t end = begin + 64U < size ? begin + 64U : size;
+
+    BitmaskWord bits = 0U;
+    for(std::size_t index = begin; index < end; ++index)
+    {
+      bits |= BitmaskWord(Comparison::apply(values[index], threshold)) << (index - begin);
+    }
+
+    mask[word] = bits;
+  }
+}
+
+template<typename Comparison, typename FloatType, typename Threshold>
+inline void compareKernel(
+    const FloatType* const values,
+    const std::size_t size,
+    const Threshold threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  scalarCompareKernel<Comparison>(values, size, threshold, mask);
+}
+
+#if defined(__AVX2__)
+
+template<typename Comparison>
+struct AvxPredicate;
+
+template<>
+struct AvxPredicate<LessComparison>: std::integral_constant<int, _CMP_LT_OQ>
+{
+};
+
+template<>
+struct AvxPredicate<LessEqualComparison>: std::integral_constant<int, _CMP_LE_OQ>
+{
+};
+
+template<>
+struct AvxPredicate<GreaterComparison>: std::integral_constant<int, _CMP_GT_OQ>
+{
+};
+
+template<>
+struct AvxPredicate<GreaterEqualComparison>: std::integral_constant<int, _CMP_GE_OQ>
+{
+};
+
+template<typename Comparison>
+inline __m256d avxCompare(const __m256d values, const double threshold) noexcept(true)
+{
+  return _mm256_cmp_pd(values, _mm256_set1_pd(threshold), AvxPredicate<Comparison>::value);
+}
+
+template<typename Comparison>
+inline __m256 avxCompare(const __m256 values, const float threshold) noexcept(true)
+{
+  return _mm256_cmp_ps(values, _mm256_set1_ps(threshold), AvxPredicate<Comparison>::value);
+}
+
+template<typename Comparison>
+inline __m256d avxCompare(const __m256d values, const Bounds<double> bounds) noexcept(true)
+{
+  return _mm256_and_pd(
+      _mm256_cmp_pd(values, _mm256_set1_pd(bounds.lower), _CMP_GE_OQ),
+      _mm256_cmp_pd(values, _mm256_set1_pd(bounds.upper), _CMP_LT_OQ));
+}
+
+template<typename Comparison>
+inline __m256 avxCompare(const __m256 values, const Bounds<float> bounds) noexcept(true)
+{
+  return _mm256_and_ps(
+      _mm256_cmp_ps(values, _mm256_set1_ps(bounds.lower), _CMP_GE_OQ),
+      _mm256_cmp_ps(values, _mm256_set1_ps(bounds.upper), _CMP_LT_OQ));
+}
+
+template<typename Comparison, typename Threshold>
+inline void compareKernel(
+    const double* const values,
+    const std::size_t size,
+    const Threshold threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  const std::size_t fullWords = size / 64U;
+  for(std::size_t word = 0; word < fullWords; ++word)
+  {
+    BitmaskWord bits = 0U;
+    for(unsigned lane = 0; lane < 64U; lane += 4U)
+    {
+      const __m256d selected =
+          avxCompare<Comparison>(_mm256_loadu_pd(values + word * 64U + lane), threshold);
+      bits |= BitmaskWord(unsigned(_mm256_movemask_pd(selected))) << lane;
+    }
+
+    mask[word] = bits;
+  }
+
+  scalarCompareKernel<Comparison>(
+      values + fullWords * 64U, size - fullWords * 64U, threshold, mask + fullWords);
+}
+
+template<typename Comparison, typename Threshold>
+inline void compareKernel(
+    const float* const values,
+    const std::size_t size,
+    const Threshold threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  const std::size_t fullWords = size / 64U;
+  for(std::size_t word = 0; word < fullWords; ++word)
+  {
+    BitmaskWord bits = 0U;
+    for(unsigned lane = 0; lane < 64U; lane += 8U)
+    {
+      const __m256 selected =
+          avxCompare<Comparison>(_mm256_loadu_ps(values + word * 64U + lane), threshold);
+      bits |= BitmaskWord(unsigned(_mm256_movemask_ps(selected))) << lane;
+    }
+
+    mask[word] = bits;
+  }
+
+  scalarCompareKernel<Comparison>(
+      values + fullWords * 64U, size - fullWords * 64U, threshold, mask + fullWords);
+}
+
+#endif
+
+/// @brief  Magnitude of @param threshold in the physical units of a column of @tparam Column.
+///         Integral thresholds are truncated toward zero by the conversion and then rounded as
+///         @tparam Rounding requires.
+template<
+    typename Rounding,
+    typename Column,
+    typename ThresholdPhysicalUnits,
+    typename FloatType,
+    typename ThresholdConversionPolicy>
+constexpr FloatType columnThreshold(
+    const AffineQuantity<ThresholdPhysicalUnits, FloatType, ThresholdConversionPolicy>
+        threshold) noexcept(true)
+{
+  return static_cast<FloatType>(
+      quantityCast<Column>(threshold).scalar() +
+      FloatType(Rounding::apply(
+          truncatedRemainder<typename Column::PhysicalUnits, ThresholdPhysicalUnits>(
+              threshold.scalar()))));
+}
+
+template<
+    typename Comparison,
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy,
+    typename Threshold>
+inline void filter(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const column,
+    const std::size_t size,
+    const Threshold threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  static_assert(
+      sizeof(AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>) == sizeof(FloatType),
+      "Batch predicates require quantities to be laid out as their underlying representation.");
+
+  compareKernel<Comparison>(reinterpret_cast<const FloatType*>(column), size, threshold, mask);
+}
+
+} // End of namespace detail.
+
+/// @brief  Sets the bit of every element of @param column strictly less than @param threshold.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @tparam ThresholdPhysicalUnits
+/// @tparam ThresholdConversionPolicy
+/// @param  column
+/// @param  size
+/// @param  threshold
+/// @param  mask        bitmaskWords(size) words.
+template<
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy,
+    typename ThresholdPhysicalUnits,
+    typename ThresholdConversionPolicy>
+void filterLess(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const column,
+    const std::size_t size,
+    const AffineQuantity<ThresholdPhysicalUnits, FloatType, ThresholdConversionPolicy> threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  using Column = AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>;
+  using Comparison = detail::LessComparison;
+  detail::filter<Comparison>(
+      column,
+      size,
+      detail::columnThreshold<Comparison::Rounding, Column>(threshold),
+      mask);
+}
+
+/// @brief  Sets the bit of every element of @param column less than or equal to @param threshold.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @tparam ThresholdPhysicalUnits
+/// @tparam ThresholdConversionPolicy
+/// @param  column
+/// @param  size
+/// @param  threshold
+/// @param  mask        bitmaskWords(size) words.
+template<
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy,
+    typename ThresholdPhysicalUnits,
+    typename ThresholdConversionPolicy>
+void filterLessEqual(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const column,
+    const std::size_t size,
+    const AffineQuantity<ThresholdPhysicalUnits, FloatType, ThresholdConversionPolicy> threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  using Column = AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>;
+  using Comparison = detail::LessEqualComparison;
+  detail::filter<Comparison>(
+      column,
+      size,
+      detail::columnThreshold<Comparison::Rounding, Column>(threshold),
+      mask);
+}
+
+/// @brief  Sets the bit of every element of @param column strictly greater than @param threshold.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @tparam ThresholdPhysicalUnits
+/// @tparam ThresholdConversionPolicy
+/// @param  column
+/// @param  size
+/// @param  threshold
+/// @param  mask        bitmaskWords(size) words.
+template<
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy,
+    typename ThresholdPhysicalUnits,
+    typename ThresholdConversionPolicy>
+void filterGreater(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const column,
+    const std::size_t size,
+    const AffineQuantity<ThresholdPhysicalUnits, FloatType, ThresholdConversionPolicy> threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  using Column = AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>;
+  using Comparison = detail::GreaterComparison;
+  detail::filter<Comparison>(
+      column,
+      size,
+      detail::columnThreshold<Comparison::Rounding, Column>(threshold),
+      mask);
+}
+
+/// @brief  Sets the bit of every element of @param column greater than or equal to
+///         @param threshold.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @tparam ThresholdPhysicalUnits
+/// @tparam ThresholdConversionPolicy
+/// @param  column
+/// @param  size
+/// @param  threshold
+/// @param  mask        bitmaskWords(size) words.
+template<
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy,
+    typename ThresholdPhysicalUnits,
+    typename ThresholdConversionPolicy>
+void filterGreaterEqual(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const column,
+    const std::size_t size,
+    const AffineQuantity<ThresholdPhysicalUnits, FloatType, ThresholdConversionPolicy> threshold,
+    BitmaskWord* const mask) noexcept(true)
+{
+  using Column = AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>;
+  using Comparison = detail::GreaterEqualComparison;
+  detail::filter<Comparison>(
+      column,
+      size,
+      detail::columnThreshold<Comparison::Rounding, Column>(threshold),
+      mask);
+}
+
+/// @brief  Sets the bit of every element of @param column within the half-open range
+///         [@param lower, @param upper). Both bounds may be expressed in any physical units of
+///         the dimensions of the column.
+///
+///         EG: filterRange(heights, size, Feet(10.0), Metres(5.0), mask)
+///
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @tparam LowerPhysicalUnits
+/// @tparam LowerConversionPolicy
+/// @tparam UpperPhysicalUnits
+/// @tparam UpperConversionPolicy
+/// @param  column
+/// @param  size
+/// @param  lower
+/// @param  upper
+/// @param  mask        bitmaskWords(size) words.
+template<
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy,
+    typename LowerPhysicalUnits,
+    typename LowerConversionPolicy,
+    typename UpperPhysicalUnits,
+    typename UpperConversionPolicy>
+void filterRange(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const column,
+    const std::size_t size,
+    const AffineQuantity<LowerPhysicalUnits, FloatType, LowerConversionPolicy> lower,
+    const AffineQuantity<UpperPhysicalUnits, FloatType, UpperConversionPolicy> upper,
+    BitmaskWord* const mask) noexcept(true)
+{
+  using Column = AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>;
+  using Comparison = detail::RangeComparison;
+  detail::filter<Comparison>(
+      column,
+      size,
+      detail::Bounds<FloatType>{ detail::columnThreshold<Comparison::Rounding, Column>(lower),
+                                 detail::columnThreshold<Comparison::Rounding, Column>(upper) },
+      mask);
+}
+
+/// @brief  Number of elements selected by @param mask.
+/// @param  mask
+/// @param  size    Number of elements the mask was computed over.
+/// @return
+inline std::size_t countSelected(const BitmaskWord* const mask, const std::size_t size) noexcept(
+    true)
+{
+  std::size_t count = 0;
+  for(std::size_t word = 0; word < bitmaskWords(size); ++word)
+  {
+    count += detail::populationCount(mask[word]);
+  }
+
+  return count;
+}
+
+/// @brief  Writes the indices of the elements selected by @param mask in increasing order.
+/// @tparam Index   Unsigned integer type of the indices. It has to represent size - 1, so columns
+///                 of more than 2^32 elements need e.g. std::size_t rather than std::uint32_t.
+/// @param  mask
+/// @param  size    Number of elements the mask was computed over.
+/// @param  indices countSelected(mask, size) entries.
+/// @return Number of indices written.
+template<typename Index>
+std::size_t selectionVector(
+    const BitmaskWord* const mask,
+    const std::size_t size,
+    Index* const indices) noexcept(true)
+{
+  static_assert(
+      std::is_integral<Index>::value and std::is_unsigned<Index>::value,
+      "The indices of a selection vector are required to be of an unsigned integer type.");
+
+  std::size_t count = 0;
+  for(std::size_t word = 0; word < bitmaskWords(size); ++word)
+  {
+    for(BitmaskWord bits = mask[word]; bits != 0U; bits &= bits - 1U)
+    {
+      indices[count++] = static_cast<Index>(word * 64U + detail::countTrailingZeros(bits));
+    }
+  }
+
+  return count;
+}
+
+/// @brief  Gathers the elements of @param column selected by @param mask, preserving their order.
+/// @tparam Element
+/// @param  column
+/// @param  size
+/// @param  mask
+/// @param  output  countSelected(mask, size) entries.
+/// @return Number of elements written.
+template<typename Element>
+std::size_t compact(
+    const Element* const column,
+    const std::size_t size,
+    const BitmaskWord* const mask,
+    Element* const output) noexcept(std::is_nothrow_copy_assignable<Element>::value)
+{
+  std::size_t count = 0;
+  for(std::size_t word = 0; word < bitmaskWords(size); ++word)
+  {
+    for(BitmaskWord bits = mask[word]; bits != 0U; bits &= bits - 1U)
+    {
+      output[count++] = column[word * 64U + detail::countTrailingZeros(bits)];
+    }
+  }
+
+  return count;
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <ratio>
+
+/// Lightweight forward declarations of the class templates of units and of the commonly used
+/// aliases. Include this header instead of si.hpp / imperial.hpp where a unit only needs to be
+/// named e.g. in a function signature. The aliases below are redeclarations of those in
+/// physicalDimensions.hpp, si.hpp and imperial.hpp; any mismatch between the two is a compile
+/// error in every translation unit that includes both.
+
+namespace units
+{
+
+template<
+    typename L_ = std::ratio<0>,
+    typename M_ = std::ratio<0>,
+    typename T_ = std::ratio<0>,
+    typename I_ = std::ratio<0>,
+    typename K_ = std::ratio<0>,
+    typename N_ = std::ratio<0>,
+    typename J_ = std::ratio<0>>
+class PhysicalDimensions;
+
+template<typename PhysicalDimensions_, typename Scale_>
+class PhysicalUnits;
+
+class ImplicitConversionPolicy;
+
+class ExplicitConversionPolicy;
+
+template<
+    typename PhysicalUnits_,
+    typename FloatType_,
+    typename ConversionPolicy_ = ImplicitConversionPolicy>
+class AffineQuantity;
+
+using Angle = PhysicalDimensions<>;
+using Length = PhysicalDimensions<std::ratio<1>>;
+using Mass = PhysicalDimensions<std::ratio<0>, std::ratio<1>>;
+using Time = PhysicalDimensions<std::ratio<0>, std::ratio<0>, std::ratio<1>>;
+using Current = PhysicalDimensions<std::ratio<0>, std::ratio<0>, std::ratio<0>, std::ratio<1>>;
+using Temperature =
+    PhysicalDimensions<std::ratio<0>, std::ratio<0>, std::ratio<0>, std::ratio<0>, std::ratio<1>>;
+using Substance = PhysicalDimensions<
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<1>>;
+using LuminousIntensity = PhysicalDimensions<
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<0>,
+    std::ratio<1>>;
+
+using RadiansPhysicalUnit = PhysicalUnits<Angle, std::ratio<1, 1>>;
+using MetresPhysicalUnit = PhysicalUnits<Length, std::ratio<1, 1>>;
+using KilogramsPhysicalUnit = PhysicalUnits<Mass, std::ratio<1, 1>>;
+using SecondsPhysicalUnit = PhysicalUnits<Time, std::ratio<1, 1>>;
+using AmperesPhysicalUnit = PhysicalUnits<Current, std::ratio<1, 1>>;
+using KelvinPhysicalUnit = PhysicalUnits<Temperature, std::ratio<1, 1>>;
+using MolesPhysicalUnits = PhysicalUnits<Substance, std::ratio<1, 1>>;
+using CandelaPhysicalUnit = PhysicalUnits<LuminousIntensity, std::ratio<1, 1>>;
+
+using Radians = AffineQuantity<RadiansPhysicalUnit, double>;
+using Metres = AffineQuantity<MetresPhysicalUnit, double>;
+using Kilograms = AffineQuantity<KilogramsPhysicalUnit, double>;
+using Seconds = AffineQuantity<SecondsPhysicalUnit, double>;
+using Ampere = AffineQuantity<AmperesPhysicalUnit, double>;
+using KelvinTemperatureDifference = AffineQuantity<KelvinPhysicalUnit, double>;
+using Moles = AffineQuantity<MolesPhysicalUnits, double>;
+using Candela = AffineQuantity<CandelaPhysicalUnit, double>;
+
+using InchesPhysicalUnit = PhysicalUnits<Length, std::ratio<254, 10000>>;
+using FeetPhysicalUnit = PhysicalUnits<Length, std::ratio<3048, 10000>>;
+using PoundsPhysicalUnit = PhysicalUnits<Mass, std::ratio<45359237, 100000000>>;
+
+using Inches = AffineQuantity<InchesPhysicalUnit, double>;
+using Feet = AffineQuantity<FeetPhysicalUnit, double>;
+using Pounds = AffineQuantity<PoundsPhysicalUnit, double>;
+
+} // End of namespace units.
\ No newline at end of file
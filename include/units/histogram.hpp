@@ -0,0 +1,461 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+/// Histograms of affine quantities for concurrent insertion. Bucket boundaries are converted to
+/// the units of the histogram once at construction and bucket lookup is branch-free: arithmetic
+/// for linear buckets, a shift of the IEEE-754 bit pattern for logarithmic ones. Counts are kept
+/// in per-thread shards, each on its own cache lines, and merged when read.
+///
+/// Every histogram has an underflow bucket (index 0) and an overflow bucket (index
+/// bucketCount() - 1) around its regular buckets.
+
+namespace units
+{
+namespace detail
+{
+
+/// Index of the shard of the calling thread. Threads are assigned shards round-robin.
+inline std::size_t histogramThreadIndex() noexcept(true)
+{
+  static std::atomic<std::size_t> next{ 0 };
+  thread_local const std::size_t index = next.fetch_add(1U, std::memory_order_relaxed);
+  return index;
+}
+
+/// @brief  Bucket counters replicated in @tparam Shards shards. Every shard starts on a cache line
+///         of its own so that threads in different shards never contend.
+template<std::size_t Shards>
+class ShardedCounters
+{
+public:
+  using SelfType = ShardedCounters<Shards>;
+
+  static_assert(Shards > 0U, "Histograms require at least one shard.");
+
+  explicit ShardedCounters(const std::size_t buckets):
+      mBuckets(buckets),
+      mStride((buckets + kCountersPerLine - 1U) / kCountersPerLine * kCountersPerLine),
+      mStorage(new std::atomic<std::uint64_t>[Shards * mStride + kCountersPerLine]()),
+      mCounters(mStorage)
+  {
+    // Over-aligned new is C++17, so the first shard is aligned to a cache line by hand.
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mCounters);
+    mCounters += (kLineSize - address % kLineSize) % kLineSize / sizeof(*mCounters);
+  }
+
+  ShardedCounters(const SelfType&) = delete;
+
+  ShardedCounters(SelfType&&) = delete;
+
+  ~ShardedCounters()
+  {
+    delete[] mStorage;
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+  void increment(const std::size_t bucket) noexcept(true)
+  {
+    const std::size_t shard = histogramThreadIndex() % Shards;
+    mCounters[shard * mStride + bucket].fetch_add(1U, std::memory_order_relaxed);
+  }
+
+  std::uint64_t count(const std::size_t bucket) const noexcept(true)
+  {
+    std::uint64_t sum = 0;
+
+    for(std::size_t shard = 0; shard < Shards; ++shard)
+    {
+      sum += mCounters[shard * mStride + bucket].load(std::memory_order_relaxed);
+    }
+
+    return sum;
+  }
+
+  std::size_t buckets() const noexcept(true)
+  {
+    return mBuckets;
+  }
+
+private:
+  static constexpr std::size_t kLineSize = 64U;
+  static constexpr std::size_t kCountersPerLine = kLineSize / sizeof(std::atomic<std::uint64_t>);
+
+  std::size_t mBuckets;
+  std::size_t mStride;
+  std::atomic<std::uint64_t>* mStorage;
+  std::atomic<std::uint64_t>* mCounters;
+};
+
+/// @brief  Rank @param fraction of the counts of @param counters, interpolated linearly inside the
+///         bucket it falls into. @param bound(index) is the lower bound of bucket index, which is
+///         also the upper bound of bucket index - 1.
+template<std::size_t Shards, typename FloatType, typename Bound>
+FloatType histogramQuantile(
+    const ShardedCounters<Shards>& counters,
+    const FloatType fraction,
+    Bound bound) noexcept(true)
+{
+  const std::size_t last = counters.buckets() - 1U;
+  std::uint64_t total = 0;
+
+  for(std::size_t bucket = 0; bucket <= last; ++bucket)
+  {
+    total += counters.count(bucket);
+  }
+
+  if(total == 0U)
+  {
+    return FloatType(0);
+  }
+
+  const FloatType target = fraction * static_cast<FloatType>(total);
+  std::uint64_t cumulative = 0;
+
+  for(std::size_t bucket = 0; bucket <= last; ++bucket)
+  {
+    const std::uint64_t count = counters.count(bucket);
+
+    if(count == 0U or static_cast<FloatType>(cumulative + count) < target)
+    {
+      cumulative += count;
+      continue;
+    }
+
+    if(bucket == 0U)
+    {
+      return bound(1U);
+    }
+
+    if(bucket == last)
+    {
+      return bound(last);
+    }
+
+    const FloatType within =
+        (target - static_cast<FloatType>(cumulative)) / static_cast<FloatType>(count);
+    const FloatType lower = bound(bucket);
+    return lower + (within < FloatType(0) ? FloatType(0) : within) * (bound(bucket + 1U) - lower);
+  }
+
+  return bound(last);
+}
+
+template<typename FloatType>
+struct FloatBits;
+
+template<>
+struct FloatBits<float>
+{
+  using Bits = std::uint32_t;
+  static constexpr unsigned kMantissaBits = 23U;
+};
+
+template<>
+struct FloatBits<double>
+{
+  using Bits = std::uint64_t;
+  static constexpr unsigned kMantissaBits = 52U;
+};
+
+} // End of namespace detail.
+
+/// @brief  Histogram of quantities in @tparam PhysicalUnits_ with equally wide buckets.
+///
+///         EG: LinearHistogram<MetresPhysicalUnit> distances(Feet(0.0), Feet(1000.0), 100U);
+///             distances.insert(Metres(42.0));
+///             distances.quantile(0.99);
+///
+/// @tparam PhysicalUnits_  Units in which the histogram is kept and quantiles are returned.
+/// @tparam FloatType_      Floating point representation.
+/// @tparam Shards_         Number of per-thread shards of the counters.
+template<typename PhysicalUnits_, typename FloatType_ = double, std::size_t Shards_ = 16U>
+class LinearHistogram
+{
+public:
+  using PhysicalUnits = PhysicalUnits_;
+  using FloatType = FloatType_;
+  using Quantity = AffineQuantity<PhysicalUnits, FloatType>;
+  using SelfType = LinearHistogram<PhysicalUnits, FloatType, Shards_>;
+
+  static_assert(
+      std::is_floating_point<FloatType>::value,
+      "Histograms require a floating point representation.");
+
+  /// @brief  Construction with @param buckets buckets of equal width spanning [@param lower,
+  ///         @param upper). The bounds may be given in any units of the same dimensions. Throws
+  ///         std::runtime_error unless buckets > 0 and lower < upper, both finite.
+  /// @param  lower
+  /// @param  upper
+  /// @param  buckets
+  LinearHistogram(const Quantity lower, const Quantity upper, const std::size_t buckets):
+      mLower(validatedLower(lower.scalar(), upper.scalar(), buckets)),
+      mWidth((upper.scalar() - lower.scalar()) / static_cast<FloatType>(buckets)),
+      mInverseWidth(static_cast<FloatType>(buckets) / (upper.scalar() - lower.scalar())),
+      mLast(static_cast<FloatType>(buckets + 1U)),
+      mCounters(buckets + 2U)
+  {
+  }
+
+  /// @brief  Counts @param sample.
+  /// @param  sample
+  void insert(const Quantity sample) noexcept(true)
+  {
+    mCounters.increment(bucket(sample));
+  }
+
+  /// @brief  Index of the bucket of @param sample, NaN going to the overflow bucket as in
+  ///         LogHistogram.
+  /// @param  sample
+  /// @return
+  std::size_t bucket(const Quantity sample) const noexcept(true)
+  {
+    // Every comparison with NaN is false, so the upper clamp comes first to catch it.
+    FloatType position = (sample.scalar() - mLower) * mInverseWidth + FloatType(1);
+    position = position < mLast ? position : mLast;
+    position = position >= FloatType(0) ? position : FloatType(0);
+    return static_cast<std::size_t>(position);
+  }
+
+  /// @brief  Number of buckets including the underflow and overflow buckets.
+  /// @return
+  std::size_t bucketCount() const noexcept(true)
+  {
+    return mCounters.buckets();
+  }
+
+  /// @brief  Number of samples in bucket @param index, merged across shards.
+  /// @param  index
+  /// @return
+  std::uint64_t count(const std::size_t index) const noexcept(true)
+  {
+    return mCounters.count(index);
+  }
+
+  /// @brief  Lower bound of the regular bucket @param index.
+  /// @param  index
+  /// @return
+  Quantity lowerBound(const std::size_t index) const noexcept(true)
+  {
+    return Quantity(bound(index));
+  }
+
+  /// @brief  Quantity below which a @param fraction in [0, 1] of the samples fall, interpolated
+  ///         within its bucket. Samples in the underflow / overflow buckets are reported at the
+  ///         lower / upper bound of the histogram. Zero for an empty histogram.
+  /// @param  fraction
+  /// @return
+  Quantity quantile(const FloatType fraction) const noexcept(true)
+  {
+    return Quantity(detail::histogramQuantile(
+        mCounters, fraction, [this](const std::size_t index) { return bound(index); }));
+  }
+
+private:
+  static FloatType validatedLower(
+      const FloatType lower,
+      const FloatType upper,
+      const std::size_t buckets)
+  {
+    if(not(buckets > 0U and lower < upper and lower >= std::numeric_limits<FloatType>::lowest() and
+           upper <= std::numeric_limits<FloatType>::max()))
+    {
+      throw std::runtime_error(
+          "Linear histograms are required to have buckets between finite bounds lower < upper.");
+    }
+
+    return lower;
+  }
+
+  FloatType bound(const std::size_t index) const noexcept(true)
+  {
+    return mLower + static_cast<FloatType>(index - 1U) * mWidth;
+  }
+
+  FloatType mLower;
+  FloatType mWidth;
+  FloatType mInverseWidth;
+  FloatType mLast;
+  detail::ShardedCounters<Shards_> mCounters;
+};
+
+/// @brief  Histogram of positive quantities in @tparam PhysicalUnits_ with logarithmically wide
+///         buckets: every power of two is split into 2^@tparam SubBucketBits_ buckets, bounding
+///         the relative width of a bucket to 2^-SubBucketBits_. The bucket of a sample is read off
+///         the exponent and leading mantissa bits of its IEEE-754 representation.
+///
+///         EG: LogHistogram<MetresPhysicalUnit> ranges(Feet(0.1), Metres(1000.0));
+///
+/// @tparam PhysicalUnits_  Units in which the histogram is kept and quantiles are returned.
+/// @tparam FloatType_      float or double.
+/// @tparam SubBucketBits_  Number of leading mantissa bits that select the bucket within a power
+///                         of two.
+/// @tparam Shards_         Number of per-thread shards of the counters.
+template<
+    typename PhysicalUnits_,
+    typename FloatType_ = double,
+    unsigned SubBucketBits_ = 3U,
+    std::size_t Shards_ = 16U>
+class LogHistogram
+{
+public:
+  using PhysicalUnits = PhysicalUnits_;
+  using FloatType = FloatType_;
+  using Quantity = AffineQuantity<PhysicalUnits, FloatType>;
+  using SelfType = LogHistogram<PhysicalUnits, FloatType, SubBucketBits_, Shards_>;
+  using Bits = typename detail::FloatBits<FloatType>::Bits;
+
+  static constexpr unsigned kShift = detail::FloatBits<FloatType>::kMantissaBits - SubBucketBits_;
+  static constexpr unsigned kSignShift = sizeof(Bits) * 8U - 1U;
+
+  static_assert(
+      SubBucketBits_ <= detail::FloatBits<FloatType>::kMantissaBits,
+      "More sub-bucket bits requested than the mantissa holds.");
+
+  /// @brief  Construction with buckets covering [@param minimum, @param maximum], both positive.
+  ///         The bounds may be given in any units of the same dimensions. Throws
+  ///         std::runtime_error unless 0 < minimum <= maximum and maximum is finite.
+  /// @param  minimum
+  /// @param  maximum
+  LogHistogram(const Quantity minimum, const Quantity maximum):
+      mMinimumKey(validatedKey(minimum.scalar(), maximum.scalar())),
+      mLast(key(maximum.scalar()) - mMinimumKey + 2),
+      mCounters(static_cast<std::size_t>(mLast) + 1U)
+  {
+  }
+
+  /// @brief  Counts @param sample.
+  /// @param  sample
+  void insert(const Quantity sample) noexcept(true)
+  {
+    mCounters.increment(bucket(sample));
+  }
+
+  /// @brief  Index of the bucket of @param sample. Zero, negative samples and -infinity go to the
+  ///         underflow bucket, NaN of either sign and +infinity to the overflow bucket.
+  /// @param  sample
+  /// @return
+  std::size_t bucket(const Quantity sample) const noexcept(true)
+  {
+    const FloatType value = sample.scalar();
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    // The position is read off the magnitude, so a NaN with its sign bit set lands past the
+    // largest finite key like any other NaN instead of counting as negative.
+    const Bits magnitude = bits & ~(Bits(1) << kSignShift);
+    const std::int64_t negative =
+        static_cast<std::int64_t>((bits >> kSignShift) & Bits(magnitude <= kInfinityBits));
+    std::int64_t position = static_cast<std::int64_t>(magnitude >> kShift) - mMinimumKey + 1;
+    position = position > 0 ? position : 0;
+    position = position < mLast ? position : mLast;
+    return static_cast<std::size_t>(position * (1 - negative));
+  }
+
+  /// @brief  Number of buckets including the underflow and overflow buckets.
+  /// @return
+  std::size_t bucketCount() const noexcept(true)
+  {
+    return mCounters.buckets();
+  }
+
+  /// @brief  Number of samples in bucket @param index, merged across shards.
+  /// @param  index
+  /// @return
+  std::uint64_t count(const std::size_t index) const noexcept(true)
+  {
+    return mCounters.count(index);
+  }
+
+  /// @brief  Lower bound of the regular bucket @param index.
+  /// @param  index
+  /// @return
+  Quantity lowerBound(const std::size_t index) const noexcept(true)
+  {
+    return Quantity(bound(index));
+  }
+
+  /// @brief  Quantity below which a @param fraction in [0, 1] of the samples fall, interpolated
+  ///         within its bucket. Samples in the underflow / overflow buckets are reported at the
+  ///         lower / upper bound of the histogram. Zero for an empty histogram.
+  /// @param  fraction
+  /// @return
+  Quantity quantile(const FloatType fraction) const noexcept(true)
+  {
+    return Quantity(detail::histogramQuantile(
+        mCounters, fraction, [this](const std::size_t index) { return bound(index); }));
+  }
+
+private:
+  /// Bit pattern of +infinity: every exponent bit set and a zero mantissa.
+  static constexpr Bits kInfinityBits =
+      ((Bits(1) << (kSignShift - detail::FloatBits<FloatType>::kMantissaBits)) - 1U)
+      << detail::FloatBits<FloatType>::kMantissaBits;
+
+  static std::int64_t key(const FloatType value) noexcept(true)
+  {
+    Bits bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return static_cast<std::int64_t>(bits >> kShift);
+  }
+
+  static std::int64_t validatedKey(const FloatType minimum, const FloatType maximum)
+  {
+    if(not(minimum > FloatType(0) and minimum <= maximum and
+           maximum <= std::numeric_limits<FloatType>::max()))
+    {
+      throw std::runtime_error(
+          "Log histogram bounds are required to satisfy 0 < minimum <= maximum < infinity.");
+    }
+
+    return key(minimum);
+  }
+
+  FloatType bound(const std::size_t index) const noexcept(true)
+  {
+    const Bits bits = static_cast<Bits>(mMinimumKey + static_cast<std::int64_t>(index) - 1)
+                      << kShift;
+    FloatType value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::int64_t mMinimumKey;
+  std::int64_t mLast;
+  detail::ShardedCounters<Shards_> mCounters;
+};
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <ostream>
+
+namespace units
+{
+
+namespace detail
+{
+
+template<typename Scale>
+struct ScalePrinter
+{
+  static void print(std::ostream& stream)
+  {
+    if(Scale::den == 1)
+    {
+      stream << Scale::num;
+    }
+    else
+    {
+      stream << Scale::num << '/' << Scale::den;
+    }
+  }
+};
+
+template<typename... PrimePowers>
+struct ScalePrinter<FactoredScale<PrimePowers...>>
+{
+  static void print(std::ostream& stream)
+  {
+    stream << ScaleValue<FactoredScale<PrimePowers...>, long double>::kValue;
+  }
+};
+
+template<typename Exponent>
+void printDimension(std::ostream& stream, const char* const symbol)
+{
+  if(Exponent::num == 0)
+  {
+    return;
+  }
+
+  stream << ' ' << symbol;
+
+  if(Exponent::num != 1 or Exponent::den != 1)
+  {
+    stream << '^' << Exponent::num;
+
+    if(Exponent::den != 1)
+    {
+      stream << '/' << Exponent::den;
+    }
+  }
+}
+
+} // End of namespace detail.
+
+/// @brief  Writes the magnitude of an affine quantity followed by its physical units expressed in
+///         S.I. base units.
+///
+///         EG: Metres(5.0)                 ->  "5 m"
+///             Inches(2.0)                 ->  "2 x 127/5000 m"
+///             Metres(3.0) / Seconds(2.0)  ->  "1.5 m s^-1"
+///
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  stream
+/// @param  quantity
+/// @return
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+std::ostream& operator<<(
+    std::ostream& stream,
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> quantity)
+{
+  using Dimensions = typename PhysicalUnits::PhysicalDimensions;
+  using Scale = typename PhysicalUnits::Scale;
+
+  stream << quantity.scalar();
+
+  if(not std::is_same<Scale, std::ratio<1>>::value)
+  {
+    stream << " x ";
+    detail::ScalePrinter<Scale>::print(stream);
+  }
+
+  detail::printDimension<typename Dimensions::L>(stream, "m");
+  detail::printDimension<typename Dimensions::M>(stream, "kg");
+  detail::printDimension<typename Dimensions::T>(stream, "s");
+  detail::printDimension<typename Dimensions::I>(stream, "A");
+  detail::printDimension<typename Dimensions::K>(stream, "K");
+  detail::printDimension<typename Dimensions::N>(stream, "mol");
+  detail::printDimension<typename Dimensions::J>(stream, "cd");
+
+  return stream;
+}
+
+} // End of namespace units.
\ No newline at end of file
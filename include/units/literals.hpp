@@ -0,0 +1,171 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "imperial.hpp"
+#include "si.hpp"
+
+/// User-defined literals for the predefined SI and Imperial units. Bring them into scope with
+/// 'using namespace units::literals;' to write 9.81_m or 3_ft instead of Metres(9.81) or Feet(3.0).
+/// Both floating point and integer literals yield quantities represented as double.
+
+namespace units
+{
+namespace literals
+{
+
+/// Quantity in radians. EG: 2.5_rad
+constexpr Radians operator""_rad(const long double value) noexcept(true)
+{
+  return Radians(static_cast<double>(value));
+}
+
+/// Quantity in radians. EG: 3_rad
+constexpr Radians operator""_rad(const unsigned long long value) noexcept(true)
+{
+  return Radians(static_cast<double>(value));
+}
+
+/// Quantity in metres. EG: 2.5_m
+constexpr Metres operator""_m(const long double value) noexcept(true)
+{
+  return Metres(static_cast<double>(value));
+}
+
+/// Quantity in metres. EG: 3_m
+constexpr Metres operator""_m(const unsigned long long value) noexcept(true)
+{
+  return Metres(static_cast<double>(value));
+}
+
+/// Quantity in kilograms. EG: 2.5_kg
+constexpr Kilograms operator""_kg(const long double value) noexcept(true)
+{
+  return Kilograms(static_cast<double>(value));
+}
+
+/// Quantity in kilograms. EG: 3_kg
+constexpr Kilograms operator""_kg(const unsigned long long value) noexcept(true)
+{
+  return Kilograms(static_cast<double>(value));
+}
+
+/// Quantity in seconds. EG: 2.5_s
+constexpr Seconds operator""_s(const long double value) noexcept(true)
+{
+  return Seconds(static_cast<double>(value));
+}
+
+/// Quantity in seconds. EG: 3_s
+constexpr Seconds operator""_s(const unsigned long long value) noexcept(true)
+{
+  return Seconds(static_cast<double>(value));
+}
+
+/// Quantity in amperes. EG: 2.5_A
+constexpr Ampere operator""_A(const long double value) noexcept(true)
+{
+  return Ampere(static_cast<double>(value));
+}
+
+/// Quantity in amperes. EG: 3_A
+constexpr Ampere operator""_A(const unsigned long long value) noexcept(true)
+{
+  return Ampere(static_cast<double>(value));
+}
+
+/// Quantity in kelvin (temperature difference). EG: 2.5_K
+constexpr KelvinTemperatureDifference operator""_K(const long double value) noexcept(true)
+{
+  return KelvinTemperatureDifference(static_cast<double>(value));
+}
+
+/// Quantity in kelvin (temperature difference). EG: 3_K
+constexpr KelvinTemperatureDifference operator""_K(const unsigned long long value) noexcept(true)
+{
+  return KelvinTemperatureDifference(static_cast<double>(value));
+}
+
+/// Quantity in moles. EG: 2.5_mol
+constexpr Moles operator""_mol(const long double value) noexcept(true)
+{
+  return Moles(static_cast<double>(value));
+}
+
+/// Quantity in moles. EG: 3_mol
+constexpr Moles operator""_mol(const unsigned long long value) noexcept(true)
+{
+  return Moles(static_cast<double>(value));
+}
+
+/// Quantity in candela. EG: 2.5_cd
+constexpr Candela operator""_cd(const long double value) noexcept(true)
+{
+  return Candela(static_cast<double>(value));
+}
+
+/// Quantity in candela. EG: 3_cd
+constexpr Candela operator""_cd(const unsigned long long value) noexcept(true)
+{
+  return Candela(static_cast<double>(value));
+}
+
+/// Quantity in inches. EG: 2.5_in
+constexpr Inches operator""_in(const long double value) noexcept(true)
+{
+  return Inches(static_cast<double>(value));
+}
+
+/// Quantity in inches. EG: 3_in
+constexpr Inches operator""_in(const unsigned long long value) noexcept(true)
+{
+  return Inches(static_cast<double>(value));
+}
+
+/// Quantity in feet. EG: 2.5_ft
+constexpr Feet operator""_ft(const long double value) noexcept(true)
+{
+  return Feet(static_cast<double>(value));
+}
+
+/// Quantity in feet. EG: 3_ft
+constexpr Feet operator""_ft(const unsigned long long value) noexcept(true)
+{
+  return Feet(static_cast<double>(value));
+}
+
+/// Quantity in pounds. EG: 2.5_lb
+constexpr Pounds operator""_lb(const long double value) noexcept(true)
+{
+  return Pounds(static_cast<double>(value));
+}
+
+/// Quantity in pounds. EG: 3_lb
+constexpr Pounds operator""_lb(const unsigned long long value) noexcept(true)
+{
+  return Pounds(static_cast<double>(value));
+}
+
+} // End of namespace literals.
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,588 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "span.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+/// Element-wise transforms of quantity columns across a work-stealing thread pool.
+///
+///     parallel::ThreadPool pool;
+///     const auto energies = parallel::transform(
+///         pool,
+///         [](const Kilograms mass, const MetresPerSecond speed) { return mass * speed * speed; },
+///         masses,
+///         speeds);
+///
+/// A range of n elements is first split into one contiguous share per worker: worker w starts on
+/// elements [w * n / workers, (w + 1) * n / workers), both bounds rounded down to whole cache
+/// lines of output. Each share is then cut into chunks of about kChunkBytes of element data, and a
+/// worker that is done with its own chunks steals half of the remaining chunks of another worker.
+/// The shares depend only on n and the number of workers, not on the element types or the chunk
+/// size, so a Buffer first touched by the pool places every share on the memory node of the worker
+/// that will transform it, and repeated passes over the same buffers stay node-local.
+///
+/// Ranges of fewer than kMinimumShareElements elements per worker engage fewer workers; with a
+/// single thread, or a single engaged worker, the transform is a plain loop on the calling thread.
+/// The per-element function must not throw.
+
+namespace units
+{
+namespace parallel
+{
+
+/// Bytes of input and output data per chunk, sized to stay within the level 2 cache.
+constexpr std::size_t kChunkBytes = 64U * 1024U;
+
+/// Cache line size assumed for chunk alignment and padding.
+constexpr std::size_t kCacheLineBytes = 64U;
+
+/// Fewest elements per worker worth waking a worker for. Counted in elements rather than bytes so
+/// that every pass over a range of a given size engages the same workers.
+constexpr std::size_t kMinimumShareElements = 1024U;
+
+/// @brief  Pool of worker threads executing chunked ranges with work stealing. The calling thread
+///         takes part as worker 0, so a pool of N threads spawns N - 1.
+class ThreadPool
+{
+public:
+  using SelfType = ThreadPool;
+
+  /// @brief  Construction with @param threads threads including the calling one. Defaults to the
+  ///         hardware concurrency.
+  /// @param  threads
+  explicit ThreadPool(const std::size_t threads = std::thread::hardware_concurrency()):
+      mSize(threads == 0U ? 1U : threads),
+      mQueues(new Queue[mSize]),
+      mThreads(new std::thread[mSize - 1U]),
+      mInvoke(nullptr),
+      mContext(nullptr),
+      mGeneration(0),
+      mActive(0),
+      mStop(false)
+  {
+    for(std::size_t worker = 1; worker < mSize; ++worker)
+    {
+      mThreads[worker - 1U] = std::thread([this, worker]() { serve(worker); });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+
+  ThreadPool(ThreadPool&&) = delete;
+
+  ~ThreadPool()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(mMutex);
+      mStop = true;
+    }
+
+    mWake.notify_all();
+
+    for(std::size_t thread = 0; thread + 1U < mSize; ++thread)
+    {
+      mThreads[thread].join();
+    }
+
+    delete[] mThreads;
+    delete[] mQueues;
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+  /// @brief  Number of threads including the calling one.
+  /// @return
+  std::size_t size() const noexcept(true)
+  {
+    return mSize;
+  }
+
+  /// @brief  Calls @param function(chunk) for every chunk in [0, @param chunks) and returns once
+  ///         all calls have completed. Worker w starts on chunks
+  ///         [w * chunks / size(), (w + 1) * chunks / size()). Calls from several threads are
+  ///         serialised, each taking the whole pool in turn; @param function must not call run on
+  ///         the same pool.
+  /// @param  chunks
+  /// @param  function
+  template<typename Function>
+  void run(const std::size_t chunks, Function& function)
+  {
+    if(size() == 1U || chunks <= 1U)
+    {
+      for(std::size_t chunk = 0; chunk < chunks; ++chunk)
+      {
+        function(chunk);
+      }
+
+      return;
+    }
+
+    // The queues, the function and the count of active workers belong to one call at a time.
+    const std::lock_guard<std::mutex> runLock(mRunMutex);
+
+    {
+      const std::lock_guard<std::mutex> lock(mMutex);
+
+      for(std::size_t worker = 0; worker < size(); ++worker)
+      {
+        const std::lock_guard<std::mutex> queueLock(mQueues[worker].mMutex);
+        mQueues[worker].mBegin = worker * chunks / size();
+        mQueues[worker].mEnd = (worker + 1U) * chunks / size();
+      }
+
+      mInvoke = [](void* const context, const std::size_t chunk) {
+        (*static_cast<Function*>(context))(chunk);
+      };
+      mContext = &function;
+      mActive = size() - 1U;
+      ++mGeneration;
+    }
+
+    mWake.notify_all();
+    work(0);
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDone.wait(lock, [this]() { return mActive == 0U; });
+  }
+
+private:
+  /// Range of chunks owned by a worker. Padded so that neighbouring queues never share a line.
+  struct Queue
+  {
+    std::mutex mMutex;
+    std::size_t mBegin = 0;
+    std::size_t mEnd = 0;
+    char mPadding[kCacheLineBytes];
+  };
+
+  void serve(const std::size_t worker)
+  {
+    std::size_t generation = 0;
+
+    while(true)
+    {
+      {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWake.wait(lock, [this, generation]() { return mStop || mGeneration != generation; });
+
+        if(mStop)
+        {
+          return;
+        }
+
+        generation = mGeneration;
+      }
+
+      work(worker);
+
+      {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        --mActive;
+      }
+
+      mDone.notify_one();
+    }
+  }
+
+  void work(const std::size_t worker)
+  {
+    std::size_t chunk;
+
+    while(pop(worker, chunk) || steal(worker, chunk))
+    {
+      mInvoke(mContext, chunk);
+    }
+  }
+
+  bool pop(const std::size_t worker, std::size_t& chunk)
+  {
+    Queue& queue = mQueues[worker];
+    const std::lock_guard<std::mutex> lock(queue.mMutex);
+
+    if(queue.mBegin == queue.mEnd)
+    {
+      return false;
+    }
+
+    chunk = queue.mBegin++;
+    return true;
+  }
+
+  /// Moves the back half of the chunks of the first non-empty victim into the queue of @param
+  /// worker and takes the first of them.
+  bool steal(const std::size_t worker, std::size_t& chunk)
+  {
+    for(std::size_t offset = 1; offset < size(); ++offset)
+    {
+      Queue& victim = mQueues[(worker + offset) % size()];
+      std::size_t begin;
+      std::size_t end;
+
+      {
+        const std::lock_guard<std::mutex> lock(victim.mMutex);
+
+        if(victim.mBegin == victim.mEnd)
+        {
+          continue;
+        }
+
+        end = victim.mEnd;
+        begin = victim.mBegin + (victim.mEnd - victim.mBegin) / 2U;
+        victim.mEnd = begin;
+      }
+
+      Queue& own = mQueues[worker];
+      const std::lock_guard<std::mutex> lock(own.mMutex);
+      chunk = begin;
+      own.mBegin = begin + 1U;
+      own.mEnd = end;
+      return true;
+    }
+
+    return false;
+  }
+
+  std::size_t mSize;
+  Queue* mQueues;
+  std::thread* mThreads;
+  std::mutex mRunMutex;
+  std::mutex mMutex;
+  std::condition_variable mWake;
+  std::condition_variable mDone;
+  void (*mInvoke)(void*, std::size_t);
+  void* mContext;
+  std::size_t mGeneration;
+  std::size_t mActive;
+  bool mStop;
+};
+
+namespace detail
+{
+
+/// Elements of @param outputBytes bytes per cache line, or 1 if they do not tile a line.
+constexpr std::size_t lineElements(const std::size_t outputBytes) noexcept(true)
+{
+  return kCacheLineBytes % outputBytes == 0U ? kCacheLineBytes / outputBytes : 1U;
+}
+
+/// Elements per chunk for @param bytesPerElement bytes of data per element, rounded to whole cache
+/// lines of @param outputBytes byte outputs.
+constexpr std::size_t chunkElements(
+    const std::size_t bytesPerElement,
+    const std::size_t outputBytes) noexcept(true)
+{
+  const std::size_t line = lineElements(outputBytes);
+  const std::size_t elements = kChunkBytes / bytesPerElement;
+  return elements < line ? line : elements / line * line;
+}
+
+/// @brief  Cut of a range of @param size elements into the shares of the workers of a pool and of
+///         every share into chunks of at most @param elements elements. Every share gets the same
+///         number of chunks, trailing ones possibly empty, so that the chunks ThreadPool::run
+///         starts worker w on are exactly those of its share.
+class ChunkPlan
+{
+public:
+  using SelfType = ChunkPlan;
+
+  ChunkPlan(
+      const std::size_t workers,
+      const std::size_t size,
+      const std::size_t outputBytes,
+      const std::size_t elements) noexcept(true):
+      mWorkers(workers),
+      mEngaged(engagedWorkers(workers, size)),
+      mSize(size),
+      mLine(lineElements(outputBytes)),
+      mElements(elements),
+      mChunksPerShare(0)
+  {
+    for(std::size_t worker = 0; worker < mEngaged; ++worker)
+    {
+      const std::size_t chunks = (bound(worker + 1U) - bound(worker) + mElements - 1U) / mElements;
+      mChunksPerShare = chunks < mChunksPerShare ? mChunksPerShare : chunks;
+    }
+  }
+
+  /// Number of workers with a non-empty share.
+  std::size_t engaged() const noexcept(true)
+  {
+    return mEngaged;
+  }
+
+  std::size_t chunks() const noexcept(true)
+  {
+    return mWorkers * mChunksPerShare;
+  }
+
+  std::size_t begin(const std::size_t chunk) const noexcept(true)
+  {
+    const std::size_t worker = chunk / mChunksPerShare;
+    const std::size_t first = bound(worker) + chunk % mChunksPerShare * mElements;
+    const std::size_t last = bound(worker + 1U);
+    return first < last ? first : last;
+  }
+
+  std::size_t end(const std::size_t chunk) const noexcept(true)
+  {
+    const std::size_t worker = chunk / mChunksPerShare;
+    const std::size_t last = bound(worker + 1U);
+    const std::size_t next = begin(chunk) + mElements;
+    return next < last ? next : last;
+  }
+
+private:
+  static std::size_t engagedWorkers(const std::size_t workers, const std::size_t size) noexcept(
+      true)
+  {
+    const std::size_t worthy = size / kMinimumShareElements;
+    return worthy < 1U ? 1U : (worthy < workers ? worthy : workers);
+  }
+
+  /// First element of the share of @param worker, the workers past the engaged ones starting
+  /// empty at the end of the range.
+  std::size_t bound(const std::size_t worker) const noexcept(true)
+  {
+    return worker < mEngaged ? worker * mSize / mEngaged / mLine * mLine : mSize;
+  }
+
+  std::size_t mWorkers;
+  std::size_t mEngaged;
+  std::size_t mSize;
+  std::size_t mLine;
+  std::size_t mElements;
+  std::size_t mChunksPerShare;
+};
+
+/// Calls @param body(begin, end) over the chunks of [0, @param size) across @param pool, cutting
+/// the range as ChunkPlan does for @param outputBytes byte outputs and @param elements elements
+/// per chunk.
+template<typename Body>
+void runChunks(
+    ThreadPool& pool,
+    const std::size_t size,
+    const std::size_t outputBytes,
+    const std::size_t elements,
+    Body& body)
+{
+  const ChunkPlan plan(pool.size(), size, outputBytes, elements);
+
+  if(plan.engaged() == 1U)
+  {
+    body(std::size_t(0), size);
+    return;
+  }
+
+  auto chunk = [&plan, &body](const std::size_t index) {
+    body(plan.begin(index), plan.end(index));
+  };
+  pool.run(plan.chunks(), chunk);
+}
+
+template<typename... Sizes>
+constexpr std::size_t sum(const Sizes... sizes) noexcept(true)
+{
+  const std::size_t values[] = { 0U, sizes... };
+
+  std::size_t result = 0;
+  for(const auto value: values)
+  {
+    result += value;
+  }
+
+  return result;
+}
+
+template<typename Output, typename Function, typename... Inputs>
+void transform(
+    ThreadPool& pool,
+    const QuantitySpan<Output> output,
+    Function& function,
+    const QuantitySpan<Inputs>... inputs)
+{
+  constexpr std::size_t kElements =
+      chunkElements(sizeof(Output) + sum(sizeof(Inputs)...), sizeof(Output));
+
+  Output* const out = output.data();
+
+  auto body = [&](const std::size_t begin, const std::size_t end) {
+    for(std::size_t element = begin; element < end; ++element)
+    {
+      out[element] = function(inputs.data()[element]...);
+    }
+  };
+
+  runChunks(pool, output.size(), sizeof(Output), kElements, body);
+}
+
+} // End of namespace detail.
+
+/// @brief  Array of quantities whose elements are first touched by the threads of a pool in the
+///         shares any transform of the same size starts from, so that on NUMA systems every share
+///         lives on the node of the worker that will transform it. The elements are
+///         value-initialised.
+/// @tparam Quantity    Trivially destructible quantity type.
+template<typename Quantity>
+class Buffer
+{
+public:
+  using SelfType = Buffer<Quantity>;
+
+  static_assert(
+      std::is_trivially_destructible<Quantity>::value,
+      "Buffers hold trivially destructible quantities.");
+
+  /// @brief  Allocation of @param size quantities, initialised by @param pool.
+  /// @param  pool
+  /// @param  size
+  Buffer(ThreadPool& pool, const std::size_t size):
+      mData(static_cast<Quantity*>(::operator new(size * sizeof(Quantity)))),
+      mSize(size)
+  {
+    constexpr std::size_t kElements = detail::chunkElements(sizeof(Quantity), sizeof(Quantity));
+    Quantity* const data = mData;
+
+    auto body = [data](const std::size_t begin, const std::size_t end) {
+      for(std::size_t element = begin; element < end; ++element)
+      {
+        new(data + element) Quantity();
+      }
+    };
+
+    detail::runChunks(pool, size, sizeof(Quantity), kElements, body);
+  }
+
+  Buffer(const Buffer&) = delete;
+
+  Buffer(Buffer&& other) noexcept(true): mData(other.mData), mSize(other.mSize)
+  {
+    other.mData = nullptr;
+    other.mSize = 0;
+  }
+
+  ~Buffer()
+  {
+    ::operator delete(mData);
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&& other) noexcept(true)
+  {
+    std::swap(mData, other.mData);
+    std::swap(mSize, other.mSize);
+    return *this;
+  }
+
+  QuantitySpan<Quantity> span() noexcept(true)
+  {
+    return QuantitySpan<Quantity>(mData, mSize);
+  }
+
+  QuantitySpan<const Quantity> span() const noexcept(true)
+  {
+    return QuantitySpan<const Quantity>(mData, mSize);
+  }
+
+  Quantity* data() noexcept(true)
+  {
+    return mData;
+  }
+
+  const Quantity* data() const noexcept(true)
+  {
+    return mData;
+  }
+
+  std::size_t size() const noexcept(true)
+  {
+    return mSize;
+  }
+
+  Quantity& operator[](const std::size_t index) noexcept(true)
+  {
+    return mData[index];
+  }
+
+  const Quantity& operator[](const std::size_t index) const noexcept(true)
+  {
+    return mData[index];
+  }
+
+private:
+  Quantity* mData;
+  std::size_t mSize;
+};
+
+/// @brief  Writes @param function(inputs[i]...) to @param output[i] for every element, across
+///         @param pool. Every input has to hold at least output.size() quantities.
+/// @param  pool
+/// @param  output
+/// @param  function
+/// @param  inputs
+template<typename Output, typename Function, typename... Inputs>
+void transform(
+    ThreadPool& pool,
+    const QuantitySpan<Output> output,
+    Function function,
+    const QuantitySpan<Inputs>... inputs)
+{
+  static_assert(sizeof...(Inputs) > 0U, "Transforms take at least one input.");
+
+  detail::transform(pool, output, function, inputs...);
+}
+
+/// @brief  Applies @param function to the elements of @param inputs across @param pool and
+///         returns the results in a Buffer of the quantity type the function returns. Every input
+///         has to hold as many quantities as the first.
+/// @param  pool
+/// @param  function
+/// @param  input
+/// @param  inputs
+/// @return
+template<typename Function, typename Input, typename... Inputs>
+auto transform(
+    ThreadPool& pool,
+    Function function,
+    const QuantitySpan<Input> input,
+    const QuantitySpan<Inputs>... inputs)
+{
+  using Output = std::decay_t<decltype(function(input.data()[0], inputs.data()[0]...))>;
+
+  Buffer<Output> output(pool, input.size());
+  detail::transform(pool, output.span(), function, input, inputs...);
+  return output;
+}
+
+} // End of namespace parallel.
+} // End of namespace units.
\ No newline at end of file
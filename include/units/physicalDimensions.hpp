@@ -23,6 +23,7 @@
  */
 #pragma once
 
+#include "fwd.hpp"
 #include <ratio>
 
 namespace units
@@ -58,15 +59,11 @@ namespace units
 /// @tparam	K_	Ratio denoting the Temperature exponent of the physical unit.
 /// @tparam	N_  Ratio denoting the Quantity of substance exponent of the physical unit.
 /// @tparam	J_	Ratio denoting the Luminous Intensity exponent of the physical unit.
+///
+/// @note   The default template arguments, std::ratio<0> for each exponent, are declared in
+///         fwd.hpp.
 
-template<
-    typename L_ = std::ratio<0>,
-    typename M_ = std::ratio<0>,
-    typename T_ = std::ratio<0>,
-    typename I_ = std::ratio<0>,
-    typename K_ = std::ratio<0>,
-    typename N_ = std::ratio<0>,
-    typename J_ = std::ratio<0>>
+template<typename L_, typename M_, typename T_, typename I_, typename K_, typename N_, typename J_>
 class PhysicalDimensions
 {
 public:
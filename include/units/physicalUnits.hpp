@@ -24,6 +24,8 @@
 #pragma once
 
 #include "physicalDimensions.hpp"
+#include "representation.hpp"
+#include "scale.hpp"
 
 namespace units
 {
@@ -44,7 +46,9 @@ namespace units
 ///
 /// @tparam	PhysicalDimensions_     The physical dimensions of the unit of measurement.
 ///
-/// @tparam	Scale_                  Scale of the physical unit w.r.t. it's S.I. counterpart.
+/// @tparam	Scale_                  Scale of the physical unit w.r.t. it's S.I. counterpart. Either
+///                                 a std::ratio or, for products of scales that overflow
+///                                 std::intmax_t, a FactoredScale.
 
 template<typename PhysicalDimensions_, typename Scale_>
 class PhysicalUnits
@@ -75,8 +79,8 @@ public:
 ///
 /// @tparam	Rhs_	RHS / Source physical units type.
 ///
-/// @tparam	FloatType_  Floating point representation to be used for representing the
-///                     resulting conversion ratio.
+/// @tparam	FloatType_  Representation of the quantities being converted. The conversion ratio is
+///                     held as the scalar type of a single lane of the representation.
 
 template<typename Lhs_, typename Rhs_, typename FloatType_>
 class PhysicalUnitsScale
@@ -92,9 +96,11 @@ public:
       std::is_same<typename Lhs::PhysicalDimensions, typename Rhs::PhysicalDimensions>::value,
       "Requested scale computation for physical units of different physical dimensions.");
 
-  using Result = std::ratio_divide<typename Rhs::Scale, typename Lhs::Scale>;
+  using Result = typename DivideScales<typename Rhs::Scale, typename Lhs::Scale>::Result;
 
-  static constexpr const FloatType kScale{ FloatType(Result::num) / FloatType(Result::den) };
+  using Scalar = typename RepresentationTraits<FloatType>::Scalar;
+
+  static constexpr const Scalar kScale{ ScaleValue<Result, Scalar>::kValue };
 
   PhysicalUnitsScale() = delete;
 
@@ -109,24 +115,96 @@ public:
   SelfType& operator=(SelfType&&) = delete;
 };
 
+/// @brief  Scale policy that keeps the product / quotient of the operand scales in the resulting
+///         physical units.
+///
+///         EG: metre * inch yields an area expressed in metre·inch. No arithmetic is spent on the
+///             product itself but every subsequent operation against an area expressed in metre²
+///             pays for a conversion.
+class PreserveScalePolicy
+{
+public:
+  using SelfType = PreserveScalePolicy;
+
+  /// Physical units retained for a product / quotient whose exact physical units are
+  /// @tparam PhysicalUnits_.
+  template<typename PhysicalUnits_>
+  using Result = PhysicalUnits_;
+
+  PreserveScalePolicy() = delete;
+
+  PreserveScalePolicy(const PreserveScalePolicy&) = delete;
+
+  PreserveScalePolicy(PreserveScalePolicy&&) = delete;
+
+  ~PreserveScalePolicy() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Scale policy that normalises the product / quotient of physical units to the coherent
+///         S.I. scale i.e. std::ratio<1, 1>.
+///
+///         EG: metre * inch yields an area expressed in metre². The scale factor 0.0254 is folded
+///             into the multiplication that produces the area so that subsequent additions and
+///             comparisons against other coherent S.I. quantities are conversion-free.
+class CanonicalScalePolicy
+{
+public:
+  using SelfType = CanonicalScalePolicy;
+
+  /// Physical units retained for a product / quotient whose exact physical units are
+  /// @tparam PhysicalUnits_.
+  template<typename PhysicalUnits_>
+  using Result = PhysicalUnits<typename PhysicalUnits_::PhysicalDimensions, std::ratio<1, 1>>;
+
+  CanonicalScalePolicy() = delete;
+
+  CanonicalScalePolicy(const CanonicalScalePolicy&) = delete;
+
+  CanonicalScalePolicy(CanonicalScalePolicy&&) = delete;
+
+  ~CanonicalScalePolicy() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// Scale policy used by MultiplyPhysicalUnits, DividePhysicalUnits and by the * and / operators of
+/// affine quantities when none is requested explicitly. Define UNITS_CANONICAL_SCALE consistently
+/// across all translation units of a program to select the CanonicalScalePolicy globally.
+#if defined(UNITS_CANONICAL_SCALE)
+using DefaultScalePolicy = CanonicalScalePolicy;
+#else
+using DefaultScalePolicy = PreserveScalePolicy;
+#endif
+
 /// @brief  Statically computes the physical units of the result of the product of operand physical
 /// units.
 /// @tparam Lhs_
 /// @tparam Rhs_
-template<typename Lhs_, typename Rhs_>
+/// @tparam ScalePolicy_    Policy deciding the scale of the resulting physical units.
+template<typename Lhs_, typename Rhs_, typename ScalePolicy_ = DefaultScalePolicy>
 class MultiplyPhysicalUnits
 {
 public:
   using Lhs = Lhs_;
   using Rhs = Rhs_;
-  using SelfType = MultiplyPhysicalUnits<Lhs, Rhs>;
+  using ScalePolicy = ScalePolicy_;
+  using SelfType = MultiplyPhysicalUnits<Lhs, Rhs, ScalePolicy>;
 
-  /// Resulting physical units that is a multiplication of LHS and RHS.
-  using Result = PhysicalUnits<
+  /// Exact physical units of the multiplication of LHS and RHS i.e. with the product of scales.
+  using ExactResult = PhysicalUnits<
       typename MultiplyPhysicalDimensions<
           typename Lhs::PhysicalDimensions,
           typename Rhs::PhysicalDimensions>::Result,
-      typename std::ratio_multiply<typename Lhs::Scale, typename Rhs::Scale>>;
+      typename MultiplyScales<typename Lhs::Scale, typename Rhs::Scale>::Result>;
+
+  /// Resulting physical units that is a multiplication of LHS and RHS.
+  using Result = typename ScalePolicy::template Result<ExactResult>;
 
   MultiplyPhysicalUnits() = delete;
 
@@ -145,20 +223,25 @@ public:
 /// units.
 /// @tparam Lhs_
 /// @tparam Rhs_
-template<typename Lhs_, typename Rhs_>
+/// @tparam ScalePolicy_    Policy deciding the scale of the resulting physical units.
+template<typename Lhs_, typename Rhs_, typename ScalePolicy_ = DefaultScalePolicy>
 class DividePhysicalUnits
 {
 public:
   using Lhs = Lhs_;
   using Rhs = Rhs_;
-  using SelfType = DividePhysicalUnits<Lhs, Rhs>;
+  using ScalePolicy = ScalePolicy_;
+  using SelfType = DividePhysicalUnits<Lhs, Rhs, ScalePolicy>;
 
-  /// Resulting physical units that is a multiplication of LHS and RHS.
-  using Result = PhysicalUnits<
+  /// Exact physical units of the division of LHS by RHS i.e. with the quotient of scales.
+  using ExactResult = PhysicalUnits<
       typename DividePhysicalDimensions<
           typename Lhs::PhysicalDimensions,
           typename Rhs::PhysicalDimensions>::Result,
-      typename std::ratio_divide<typename Lhs::Scale, typename Rhs::Scale>>;
+      typename DivideScales<typename Lhs::Scale, typename Rhs::Scale>::Result>;
+
+  /// Resulting physical units that is a division of LHS by RHS.
+  using Result = typename ScalePolicy::template Result<ExactResult>;
 
   DividePhysicalUnits() = delete;
 
@@ -0,0 +1,241 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#if __cplusplus < 201703L
+#error "units/pmr.hpp requires C++17 for std::pmr."
+#endif
+
+#include "affineQuantity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+/// Allocator-aware containers of quantities backed by std::pmr::memory_resource, a bump arena to
+/// serve them from a per-request buffer, and bulk operations that allocate their outputs from the
+/// resource of their inputs.
+
+namespace units
+{
+namespace pmr
+{
+
+/// Vector of quantities allocating from a std::pmr::memory_resource.
+///
+/// EG: QuantityVector<Metres> lengths(&arena);
+template<typename Quantity>
+using QuantityVector = std::pmr::vector<Quantity>;
+
+/// @brief  Memory resource that serves allocations by bumping a pointer through a buffer sized
+///         once per request. Deallocation is a no-op; reset() reclaims everything at once at the
+///         end of the request. Allocations that do not fit in the buffer are forwarded to the
+///         upstream resource and released by reset() or on destruction.
+///
+///         Not thread-safe: use one arena per request / thread.
+class BumpArena: public std::pmr::memory_resource
+{
+public:
+  using SelfType = BumpArena;
+
+  /// @brief  Construction with a buffer of @param capacity bytes obtained from @param upstream.
+  /// @param  capacity
+  /// @param  upstream
+  explicit BumpArena(
+      const std::size_t capacity,
+      std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()):
+      mUpstream(upstream),
+      mBuffer(static_cast<std::byte*>(upstream->allocate(capacity, alignof(std::max_align_t)))),
+      mCapacity(capacity),
+      mUsed(0),
+      mOverflow(upstream)
+  {
+  }
+
+  BumpArena(const BumpArena&) = delete;
+
+  BumpArena(BumpArena&&) = delete;
+
+  ~BumpArena() override
+  {
+    reset();
+    mUpstream->deallocate(mBuffer, mCapacity, alignof(std::max_align_t));
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+  /// @brief  Reclaims every allocation made since construction or the previous reset. Memory
+  ///         handed out before the reset must no longer be used.
+  void reset() noexcept(true)
+  {
+    for(const auto& block: mOverflow)
+    {
+      mUpstream->deallocate(block.pointer, block.bytes, block.alignment);
+    }
+
+    mOverflow.clear();
+    mUsed = 0;
+  }
+
+  /// @brief  Bytes of the buffer in use, including alignment padding.
+  /// @return
+  std::size_t used() const noexcept(true)
+  {
+    return mUsed;
+  }
+
+  /// @brief  Size of the buffer in bytes.
+  /// @return
+  std::size_t capacity() const noexcept(true)
+  {
+    return mCapacity;
+  }
+
+  /// @brief  Number of live allocations that did not fit in the buffer. A non-zero value after a
+  ///         typical request suggests increasing the capacity.
+  /// @return
+  std::size_t overflowCount() const noexcept(true)
+  {
+    return mOverflow.size();
+  }
+
+private:
+  struct Block
+  {
+    void* pointer;
+    std::size_t bytes;
+    std::size_t alignment;
+  };
+
+  void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(mBuffer) + mUsed;
+    const std::size_t padding = (alignment - address % alignment) % alignment;
+
+    if(padding + bytes <= mCapacity - mUsed)
+    {
+      mUsed += padding + bytes;
+      return mBuffer + (mUsed - bytes);
+    }
+
+    void* const pointer = mUpstream->allocate(bytes, alignment);
+
+    try
+    {
+      mOverflow.push_back(Block{ pointer, bytes, alignment });
+    }
+    catch(...)
+    {
+      mUpstream->deallocate(pointer, bytes, alignment);
+      throw;
+    }
+
+    return pointer;
+  }
+
+  void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+  bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override
+  {
+    return this == &rhs;
+  }
+
+  std::pmr::memory_resource* mUpstream;
+  std::byte* mBuffer;
+  std::size_t mCapacity;
+  std::size_t mUsed;
+  std::pmr::vector<Block> mOverflow;
+};
+
+/// @brief  Applies @param function to every element of @param input. The result is allocated
+///         from the memory resource of @param input.
+/// @tparam Quantity
+/// @tparam Function
+/// @param  input
+/// @param  function
+/// @return
+template<typename Quantity, typename Function>
+auto transform(const QuantityVector<Quantity>& input, Function function)
+{
+  using Result = std::decay_t<decltype(function(input.front()))>;
+
+  QuantityVector<Result> output(input.get_allocator());
+  output.reserve(input.size());
+
+  for(const auto& element: input)
+  {
+    output.push_back(function(element));
+  }
+
+  return output;
+}
+
+/// @brief  Applies @param function to the pairs of elements of @param lhs and @param rhs, which
+///         are required to be of the same size. The result is allocated from the memory resource
+///         of @param lhs.
+///
+///         EG: transform(distances, durations, [](auto d, auto t) { return d / t; })
+///
+/// @tparam LhsQuantity
+/// @tparam RhsQuantity
+/// @tparam Function
+/// @param  lhs
+/// @param  rhs
+/// @param  function
+/// @return
+template<typename LhsQuantity, typename RhsQuantity, typename Function>
+auto transform(
+    const QuantityVector<LhsQuantity>& lhs,
+    const QuantityVector<RhsQuantity>& rhs,
+    Function function)
+{
+  using Result = std::decay_t<decltype(function(lhs.front(), rhs.front()))>;
+
+  QuantityVector<Result> output(lhs.get_allocator());
+  output.reserve(lhs.size());
+
+  for(std::size_t index = 0; index < lhs.size(); ++index)
+  {
+    output.push_back(function(lhs[index], rhs[index]));
+  }
+
+  return output;
+}
+
+/// @brief  Converts every element of @param input into @tparam Target with quantityCast. The
+///         result is allocated from the memory resource of @param input.
+/// @tparam Target
+/// @tparam Quantity
+/// @param  input
+/// @return
+template<typename Target, typename Quantity>
+QuantityVector<Target> convert(const QuantityVector<Quantity>& input)
+{
+  return transform(input, [](const Quantity quantity) { return quantityCast<Target>(quantity); });
+}
+
+} // End of namespace pmr.
+} // End of namespace units.
\ No newline at end of file
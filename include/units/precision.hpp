@@ -0,0 +1,290 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/// Precision policies for unit conversions, selected per call through
+/// quantityCast<Target, Precision>(quantity). Bounds below are for round-to-nearest IEEE-754
+/// arithmetic with u the unit roundoff of the representation (2^-53 for double) and s the exact
+/// scale num / den. Every policy returns the magnitude untouched when the scale is one.
+///
+///     FastPrecision           x * fl(s). One multiply. Error <= 2u |x s|, i.e. about one ulp.
+///                             Not exact even for integral x: 3 dm is 0.30000000000000004 m.
+///     ExactRatioPrecision     fl(x * num) / den. A multiply and a divide. Correctly rounded,
+///                             and hence exact whenever x s is representable, provided x * num
+///                             is exact e.g. integral x with |x * num| <= 2^53. Otherwise
+///                             <= 2u |x s|. x * num may overflow for very large num. Relies
+///                             on a true division: -ffast-math (-freciprocal-math) rewrites it
+///                             into a multiply by the rounded reciprocal and voids the bound.
+///     DoubleDoublePrecision   fma(x, hi, x * lo) with s = hi + lo held as a double-double
+///                             computed at compile time. A multiply and a fused multiply-add.
+///                             Error <= u/2 |x s| + 2u² |x s|, i.e. correctly rounded except
+///                             within ~2^-52 ulp of a tie, for any x. Uses std::fma, which is only
+///                             a single instruction when the target has FMA (e.g. -mfma). The
+///                             bound holds under -ffast-math too, as the fused multiply-add is
+///                             not reassociated.
+///
+/// num and den are taken as exact in the representation as long as they do not exceed 2^digits
+/// (2^53 for double). Larger terms and FactoredScales are accumulated in long double, and
+/// DoubleDoublePrecision then derives lo from long double as well, bounding |s - hi - lo| by the
+/// long double roundoff (2^-64 on x86, u where long double is double).
+///
+/// The ExactRatioPrecision and DoubleDoublePrecision policies require a scalar floating point
+/// representation.
+
+namespace units
+{
+namespace detail
+{
+
+template<typename FloatType>
+constexpr std::intmax_t exactIntegerLimit()
+{
+  return std::numeric_limits<FloatType>::digits >= 63
+             ? INTMAX_MAX
+             : (std::intmax_t(1) << std::numeric_limits<FloatType>::digits);
+}
+
+/// Numerator and denominator of @tparam Scale in @tparam FloatType.
+template<typename Scale, typename FloatType>
+struct ScaleTerms
+{
+  static constexpr FloatType kNum = FloatType(Scale::num);
+  static constexpr FloatType kDen = FloatType(Scale::den);
+  static constexpr bool kExact =
+      Scale::num <= exactIntegerLimit<FloatType>() and Scale::den <= exactIntegerLimit<FloatType>();
+};
+
+template<typename... PrimePowers, typename FloatType>
+struct ScaleTerms<FactoredScale<PrimePowers...>, FloatType>
+{
+  static constexpr FloatType kNum = FloatType(floatProduct(
+      power(static_cast<long double>(PrimePowers::kPrime), PrimePowers::kExponent)...));
+  static constexpr FloatType kDen = FloatType(floatProduct(
+      power(static_cast<long double>(PrimePowers::kPrime), -PrimePowers::kExponent)...));
+  static constexpr bool kExact = false;
+};
+
+/// Low part of num / den given its rounded high part. high * den is split exactly into two terms
+/// with Dekker's product, so that num - high * den is the exact residual up to one rounding.
+template<typename FloatType>
+constexpr FloatType lowPart(const FloatType num, const FloatType den, const FloatType high)
+{
+  const FloatType splitter =
+      FloatType(std::intmax_t(1) << ((std::numeric_limits<FloatType>::digits + 1) / 2)) +
+      FloatType(1);
+
+  const FloatType highSplit = splitter * high;
+  const FloatType highHigh = highSplit - (highSplit - high);
+  const FloatType highLow = high - highHigh;
+  const FloatType denSplit = splitter * den;
+  const FloatType denHigh = denSplit - (denSplit - den);
+  const FloatType denLow = den - denHigh;
+
+  const FloatType product = high * den;
+  const FloatType error =
+      ((highHigh * denHigh - product) + highHigh * denLow + highLow * denHigh) + highLow * denLow;
+
+  return ((num - product) - error) / den;
+}
+
+/// @tparam Scale as the unevaluated sum kHigh + kLow.
+template<typename Scale, typename FloatType, bool = ScaleTerms<Scale, FloatType>::kExact>
+struct DoubleDoubleScale
+{
+  static constexpr FloatType kHigh =
+      ScaleTerms<Scale, FloatType>::kNum / ScaleTerms<Scale, FloatType>::kDen;
+  static constexpr FloatType kLow = lowPart(
+      ScaleTerms<Scale, FloatType>::kNum,
+      ScaleTerms<Scale, FloatType>::kDen,
+      kHigh);
+};
+
+template<typename Scale, typename FloatType>
+struct DoubleDoubleScale<Scale, FloatType, false>
+{
+  static constexpr long double kValue = ScaleValue<Scale, long double>::kValue;
+  static constexpr FloatType kHigh = FloatType(kValue);
+  static constexpr FloatType kLow = FloatType(kValue - static_cast<long double>(kHigh));
+};
+
+} // End of namespace detail.
+
+/// @brief  Precision policy converting with the single multiply by the rounded scale also used by
+///         the implicit conversions. See the bounds above.
+class FastPrecision
+{
+public:
+  using SelfType = FastPrecision;
+
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static constexpr FloatType convert(const FloatType value) noexcept(true)
+  {
+    return detail::rescale<ToPhysicalUnits, FromPhysicalUnits>(value);
+  }
+
+  FastPrecision() = delete;
+
+  FastPrecision(const FastPrecision&) = delete;
+
+  FastPrecision(FastPrecision&&) = delete;
+
+  ~FastPrecision() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Precision policy converting with a multiply by the numerator of the scale followed by
+///         a divide by its denominator. See the bounds above.
+class ExactRatioPrecision
+{
+public:
+  using SelfType = ExactRatioPrecision;
+
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static constexpr FloatType convert(const FloatType value) noexcept(true)
+  {
+    static_assert(
+        std::is_floating_point<FloatType>::value,
+        "ExactRatioPrecision requires a scalar floating point representation.");
+
+    return convert<ToPhysicalUnits, FromPhysicalUnits>(
+        value, detail::IsUnitScale<FromPhysicalUnits, ToPhysicalUnits>{});
+  }
+
+  ExactRatioPrecision() = delete;
+
+  ExactRatioPrecision(const ExactRatioPrecision&) = delete;
+
+  ExactRatioPrecision(ExactRatioPrecision&&) = delete;
+
+  ~ExactRatioPrecision() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+private:
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static constexpr FloatType convert(const FloatType value, std::true_type) noexcept(true)
+  {
+    return detail::rescale<ToPhysicalUnits, FromPhysicalUnits>(value, std::true_type{});
+  }
+
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static constexpr FloatType convert(const FloatType value, std::false_type) noexcept(true)
+  {
+    using Terms = detail::ScaleTerms<
+        typename PhysicalUnitsScale<ToPhysicalUnits, FromPhysicalUnits, FloatType>::Result,
+        FloatType>;
+
+    return value * Terms::kNum / Terms::kDen;
+  }
+};
+
+/// @brief  Precision policy converting with the scale held as a double-double and applied with a
+///         fused multiply-add. See the bounds above. Not usable in constant expressions.
+class DoubleDoublePrecision
+{
+public:
+  using SelfType = DoubleDoublePrecision;
+
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static FloatType convert(const FloatType value) noexcept(true)
+  {
+    static_assert(
+        std::is_floating_point<FloatType>::value,
+        "DoubleDoublePrecision requires a scalar floating point representation.");
+
+    return convert<ToPhysicalUnits, FromPhysicalUnits>(
+        value, detail::IsUnitScale<FromPhysicalUnits, ToPhysicalUnits>{});
+  }
+
+  DoubleDoublePrecision() = delete;
+
+  DoubleDoublePrecision(const DoubleDoublePrecision&) = delete;
+
+  DoubleDoublePrecision(DoubleDoublePrecision&&) = delete;
+
+  ~DoubleDoublePrecision() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+private:
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static FloatType convert(const FloatType value, std::true_type) noexcept(true)
+  {
+    return detail::rescale<ToPhysicalUnits, FromPhysicalUnits>(value, std::true_type{});
+  }
+
+  template<typename ToPhysicalUnits, typename FromPhysicalUnits, typename FloatType>
+  static FloatType convert(const FloatType value, std::false_type) noexcept(true)
+  {
+    using Scale = detail::DoubleDoubleScale<
+        typename PhysicalUnitsScale<ToPhysicalUnits, FromPhysicalUnits, FloatType>::Result,
+        FloatType>;
+
+    return std::fma(value, Scale::kHigh, value * Scale::kLow);
+  }
+};
+
+/// @brief  Explicit conversion of a quantity into the physical units, representation and
+///         conversion policy of @tparam Target, with the rounding behaviour of @tparam Precision.
+///
+///         EG: quantityCast<Metres, ExactRatioPrecision>(Inches(12.0))
+///
+/// @tparam Target      Specialization of AffineQuantity of the same physical dimensions.
+/// @tparam Precision   One of FastPrecision, ExactRatioPrecision or DoubleDoublePrecision.
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  quantity
+/// @return
+template<
+    typename Target,
+    typename Precision,
+    typename PhysicalUnits,
+    typename FloatType,
+    typename ConversionPolicy>
+constexpr Target quantityCast(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy> quantity
+        UNITS_CONVERSION_AUDIT_PARAMETER) noexcept(true)
+{
+  UNITS_CONVERSION_AUDIT_RECORD(PhysicalUnits, typename Target::PhysicalUnits);
+
+  return Target(static_cast<typename Target::FloatType>(
+      Precision::template convert<typename Target::PhysicalUnits, PhysicalUnits>(
+          quantity.scalar())));
+}
+
+} // End of namespace units.
\ No newline at end of file
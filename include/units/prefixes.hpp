@@ -0,0 +1,203 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "si.hpp"
+
+/// S.I. prefixes as templates over physical units and affine quantities. A prefix multiplies the
+/// scale of the physical units at compile time, so chains of prefixes and compound units built
+/// from prefixed units always carry a single scale, and a conversion between any two of them is
+/// one precomputed multiply. Prefixes that cancel, e.g. Kilo<Milli<MetresPhysicalUnit>>, yield
+/// the unprefixed type itself and convert without any multiply.
+///
+///     EG: Kilo<MetresPhysicalUnit>, Milli<Seconds>, Micro<Grams>.
+///
+/// The prefixes beyond 10^±18 do not fit a std::ratio and are held as a FactoredScale.
+
+namespace units
+{
+namespace detail
+{
+
+template<typename Units, typename Factor>
+struct Prefixed;
+
+template<typename PhysicalDimensions, typename Scale, typename Factor>
+struct Prefixed<PhysicalUnits<PhysicalDimensions, Scale>, Factor>
+{
+  using Type =
+      PhysicalUnits<PhysicalDimensions, typename units::MultiplyScales<Scale, Factor>::Result>;
+};
+
+template<typename PhysicalUnits, typename FloatType, typename ConversionPolicy, typename Factor>
+struct Prefixed<AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>, Factor>
+{
+  using Type = AffineQuantity<
+      typename Prefixed<PhysicalUnits, Factor>::Type,
+      FloatType,
+      ConversionPolicy>;
+};
+
+/// 10^Exponent as a std::ratio when it fits and a FactoredScale otherwise.
+template<std::intmax_t Exponent>
+using PowerOfTen =
+    typename Normalize<FactoredScale<PrimePower<2, Exponent>, PrimePower<5, Exponent>>>::Type;
+
+} // End of namespace detail.
+
+/// @brief  @tparam Units, either PhysicalUnits or an AffineQuantity, with its scale multiplied by
+///         @tparam Factor, a std::ratio or FactoredScale.
+template<typename Units, typename Factor>
+using Prefix = typename detail::Prefixed<Units, Factor>::Type;
+
+template<typename Units>
+using Quetta = Prefix<Units, detail::PowerOfTen<30>>;
+
+template<typename Units>
+using Ronna = Prefix<Units, detail::PowerOfTen<27>>;
+
+template<typename Units>
+using Yotta = Prefix<Units, detail::PowerOfTen<24>>;
+
+template<typename Units>
+using Zetta = Prefix<Units, detail::PowerOfTen<21>>;
+
+template<typename Units>
+using Exa = Prefix<Units, detail::PowerOfTen<18>>;
+
+template<typename Units>
+using Peta = Prefix<Units, detail::PowerOfTen<15>>;
+
+template<typename Units>
+using Tera = Prefix<Units, detail::PowerOfTen<12>>;
+
+template<typename Units>
+using Giga = Prefix<Units, detail::PowerOfTen<9>>;
+
+template<typename Units>
+using Mega = Prefix<Units, detail::PowerOfTen<6>>;
+
+template<typename Units>
+using Kilo = Prefix<Units, detail::PowerOfTen<3>>;
+
+template<typename Units>
+using Hecto = Prefix<Units, detail::PowerOfTen<2>>;
+
+template<typename Units>
+using Deca = Prefix<Units, detail::PowerOfTen<1>>;
+
+template<typename Units>
+using Deci = Prefix<Units, detail::PowerOfTen<-1>>;
+
+template<typename Units>
+using Centi = Prefix<Units, detail::PowerOfTen<-2>>;
+
+template<typename Units>
+using Milli = Prefix<Units, detail::PowerOfTen<-3>>;
+
+template<typename Units>
+using Micro = Prefix<Units, detail::PowerOfTen<-6>>;
+
+template<typename Units>
+using Nano = Prefix<Units, detail::PowerOfTen<-9>>;
+
+template<typename Units>
+using Pico = Prefix<Units, detail::PowerOfTen<-12>>;
+
+template<typename Units>
+using Femto = Prefix<Units, detail::PowerOfTen<-15>>;
+
+template<typename Units>
+using Atto = Prefix<Units, detail::PowerOfTen<-18>>;
+
+template<typename Units>
+using Zepto = Prefix<Units, detail::PowerOfTen<-21>>;
+
+template<typename Units>
+using Yocto = Prefix<Units, detail::PowerOfTen<-24>>;
+
+template<typename Units>
+using Ronto = Prefix<Units, detail::PowerOfTen<-27>>;
+
+template<typename Units>
+using Quecto = Prefix<Units, detail::PowerOfTen<-30>>;
+
+} // End of namespace units.
+
+/// Invokes X(Prefix, ...) for every S.I. prefix, forwarding the remaining arguments.
+#define UNITS_SI_PREFIXES(X, ...)                                                                  \
+  X(Quetta, __VA_ARGS__)                                                                           \
+  X(Ronna, __VA_ARGS__)                                                                            \
+  X(Yotta, __VA_ARGS__)                                                                            \
+  X(Zetta, __VA_ARGS__)                                                                            \
+  X(Exa, __VA_ARGS__)                                                                              \
+  X(Peta, __VA_ARGS__)                                                                             \
+  X(Tera, __VA_ARGS__)                                                                             \
+  X(Giga, __VA_ARGS__)                                                                             \
+  X(Mega, __VA_ARGS__)                                                                             \
+  X(Kilo, __VA_ARGS__)                                                                             \
+  X(Hecto, __VA_ARGS__)                                                                            \
+  X(Deca, __VA_ARGS__)                                                                             \
+  X(Deci, __VA_ARGS__)                                                                             \
+  X(Centi, __VA_ARGS__)                                                                            \
+  X(Milli, __VA_ARGS__)                                                                            \
+  X(Micro, __VA_ARGS__)                                                                            \
+  X(Nano, __VA_ARGS__)                                                                             \
+  X(Pico, __VA_ARGS__)                                                                             \
+  X(Femto, __VA_ARGS__)                                                                            \
+  X(Atto, __VA_ARGS__)                                                                             \
+  X(Zepto, __VA_ARGS__)                                                                            \
+  X(Yocto, __VA_ARGS__)                                                                            \
+  X(Ronto, __VA_ARGS__)                                                                            \
+  X(Quecto, __VA_ARGS__)
+
+/// Invokes X(Prefix, stem, Quantity, Units) for every S.I. unit that has prefixed aliases.
+#define UNITS_SI_PREFIXED_UNITS(X)                                                                 \
+  UNITS_SI_PREFIXES(X, radians, Radians, RadiansPhysicalUnit)                                      \
+  UNITS_SI_PREFIXES(X, metres, Metres, MetresPhysicalUnit)                                         \
+  UNITS_SI_PREFIXES(X, grams, Grams, GramsPhysicalUnit)                                            \
+  UNITS_SI_PREFIXES(X, seconds, Seconds, SecondsPhysicalUnit)                                      \
+  UNITS_SI_PREFIXES(X, amperes, Ampere, AmperesPhysicalUnit)                                       \
+  UNITS_SI_PREFIXES(X, kelvin, KelvinTemperatureDifference, KelvinPhysicalUnit)                    \
+  UNITS_SI_PREFIXES(X, moles, Moles, MolesPhysicalUnits)                                           \
+  UNITS_SI_PREFIXES(X, candela, Candela, CandelaPhysicalUnit)
+
+/// Declares Prefix##stem##PhysicalUnit and Prefix##stem, e.g. KilometresPhysicalUnit and
+/// Kilometres.
+#define UNITS_DECLARE_PREFIXED_UNIT(Prefix, stem, Quantity, Units)                                 \
+  using Prefix##stem##PhysicalUnit = Prefix<Units>;                                                \
+  using Prefix##stem = Prefix<Quantity>;
+
+namespace units
+{
+
+/// Physical units representing mass in grams, the stem the prefixes of mass attach to.
+using GramsPhysicalUnit = Milli<KilogramsPhysicalUnit>;
+
+/// Grams
+using Grams = AffineQuantity<GramsPhysicalUnit, double>;
+
+UNITS_SI_PREFIXED_UNITS(UNITS_DECLARE_PREFIXED_UNIT)
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,650 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cstddef>
+#include <utility>
+
+namespace units
+{
+
+
+/// @brief  Template class to represent a compile-time list of physical units. Used to describe the
+///         heterogeneous units of the elements of a @class StateVector and of the rows / columns of
+///         a @class QuantityMatrix.
+///
+///         EG: PhysicalUnitsList<MetresPhysicalUnit, MetresPhysicalUnit, RadiansPhysicalUnit>
+///             describes a planar pose [x m, y m, heading rad].
+///
+/// @tparam PhysicalUnits_  Physical units of each element.
+
+template<typename... PhysicalUnits_>
+class PhysicalUnitsList
+{
+public:
+  using SelfType = PhysicalUnitsList<PhysicalUnits_...>;
+
+  static constexpr std::size_t kSize = sizeof...(PhysicalUnits_);
+
+  PhysicalUnitsList() = delete;
+
+  PhysicalUnitsList(const PhysicalUnitsList&) = delete;
+
+  PhysicalUnitsList(PhysicalUnitsList&&) = delete;
+
+  ~PhysicalUnitsList() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+namespace detail
+{
+
+template<std::size_t Index, typename... Types>
+struct TypeAt;
+
+template<typename Head, typename... Tail>
+struct TypeAt<0, Head, Tail...>
+{
+  using Type = Head;
+};
+
+template<std::size_t Index, typename Head, typename... Tail>
+struct TypeAt<Index, Head, Tail...>
+{
+  using Type = typename TypeAt<Index - 1, Tail...>::Type;
+};
+
+template<typename List, std::size_t Index>
+struct ListAt;
+
+template<typename... PhysicalUnits, std::size_t Index>
+struct ListAt<PhysicalUnitsList<PhysicalUnits...>, Index>
+{
+  using Type = typename TypeAt<Index, PhysicalUnits...>::Type;
+};
+
+template<typename... Values>
+constexpr bool allOf(const Values... values)
+{
+  const bool array[] = { true, values... };
+
+  for(const auto value: array)
+  {
+    if(not value)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template<typename FloatType>
+constexpr FloatType magnitude(const FloatType value)
+{
+  return value < FloatType(0) ? -value : value;
+}
+
+/// Two physical units are equivalent if values expressed in one of them need no conversion to be
+/// expressed in the other i.e. same physical dimensions and a scale ratio of exactly 1.
+template<typename Lhs, typename Rhs>
+constexpr bool areEquivalent()
+{
+  return std::is_same<typename Lhs::PhysicalDimensions, typename Rhs::PhysicalDimensions>::value and
+         std::is_same<
+             typename DivideScales<typename Lhs::Scale, typename Rhs::Scale>::Result,
+             std::ratio<1>>::value;
+}
+
+template<typename Lhs, typename Rhs, bool = (Lhs::kSize == Rhs::kSize)>
+struct AreEquivalentLists: std::false_type
+{
+};
+
+template<typename... LhsPhysicalUnits, typename... RhsPhysicalUnits>
+struct AreEquivalentLists<
+    PhysicalUnitsList<LhsPhysicalUnits...>,
+    PhysicalUnitsList<RhsPhysicalUnits...>,
+    true>
+    : std::integral_constant<
+          bool,
+          allOf(areEquivalent<LhsPhysicalUnits, RhsPhysicalUnits>()...)>
+{
+};
+
+} // End of namespace detail.
+
+/// @brief  Statically computes the list of reciprocal physical units of a @class PhysicalUnitsList.
+///         The reciprocal of metre is metre⁻¹, of second is hertz and so on.
+/// @tparam List_
+template<typename List_>
+class InversePhysicalUnitsList;
+
+template<typename... PhysicalUnits_>
+class InversePhysicalUnitsList<PhysicalUnitsList<PhysicalUnits_...>>
+{
+public:
+  using List = PhysicalUnitsList<PhysicalUnits_...>;
+  using SelfType = InversePhysicalUnitsList<List>;
+
+  /// List of the reciprocal of each physical unit in @tparam List_.
+  using Result = PhysicalUnitsList<typename DividePhysicalUnits<
+      PhysicalUnits<PhysicalDimensions<>, std::ratio<1>>,
+      PhysicalUnits_,
+      PreserveScalePolicy>::Result...>;
+
+  InversePhysicalUnitsList() = delete;
+
+  InversePhysicalUnitsList(const InversePhysicalUnitsList&) = delete;
+
+  InversePhysicalUnitsList(InversePhysicalUnitsList&&) = delete;
+
+  ~InversePhysicalUnitsList() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Template class to represent a fixed-size vector of quantities of heterogeneous physical
+///         units, e.g. the state of an estimation filter [x m, y m, vx m/s, vy m/s, heading rad].
+///
+///         The magnitudes are stored as a dense aligned block of FloatType so that vector and
+///         matrix kernels operate on raw memory; the units are only tracked in the type.
+///
+/// @tparam FloatType_          Floating point representation of the magnitudes.
+///
+/// @tparam UnitsList_  @class PhysicalUnitsList describing the units of each element.
+
+template<typename FloatType_, typename UnitsList_>
+class StateVector
+{
+public:
+  using FloatType = FloatType_;
+  using UnitsList = UnitsList_;
+  using SelfType = StateVector<FloatType, UnitsList>;
+
+  static constexpr std::size_t kSize = UnitsList::kSize;
+
+  /// Type of the element at @tparam Index.
+  template<std::size_t Index>
+  using Element =
+      AffineQuantity<typename detail::ListAt<UnitsList, Index>::Type, FloatType>;
+
+  /// @brief  Default constructor with 0 initialization.
+  constexpr StateVector() noexcept(true): mValues{} {}
+
+  /// @brief  Method to access the element at @tparam Index.
+  /// @return
+  template<std::size_t Index>
+  constexpr Element<Index> get() const noexcept(true)
+  {
+    static_assert(Index < kSize, "Requested element is out of bounds of the state vector.");
+    return Element<Index>(mValues[Index]);
+  }
+
+  /// @brief  Method to set the element at @tparam Index. Quantities of compatible physical units
+  ///         are converted implicitly.
+  /// @param  quantity
+  template<std::size_t Index>
+  constexpr void set(const Element<Index> quantity) noexcept(true)
+  {
+    static_assert(Index < kSize, "Requested element is out of bounds of the state vector.");
+    mValues[Index] = quantity.scalar();
+  }
+
+  /// @brief  Raw access to the magnitudes for use in numerical kernels.
+  /// @return
+  constexpr FloatType* data() noexcept(true)
+  {
+    return mValues;
+  }
+
+  /// @brief  Raw access to the magnitudes for use in numerical kernels.
+  /// @return
+  constexpr const FloatType* data() const noexcept(true)
+  {
+    return mValues;
+  }
+
+  /// @brief  Addition assignment operator.
+  /// @param  rhs
+  /// @return
+  constexpr SelfType& operator+=(const SelfType& rhs) noexcept(true)
+  {
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      mValues[index] += rhs.mValues[index];
+    }
+
+    return *this;
+  }
+
+  /// @brief  Subtraction assignment operator.
+  /// @param  rhs
+  /// @return
+  constexpr SelfType& operator-=(const SelfType& rhs) noexcept(true)
+  {
+    for(std::size_t index = 0; index < kSize; ++index)
+    {
+      mValues[index] -= rhs.mValues[index];
+    }
+
+    return *this;
+  }
+
+private:
+  alignas(64) FloatType mValues[kSize];
+};
+
+/// @brief
+/// @tparam FloatType
+/// @tparam UnitsList
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename FloatType, typename UnitsList>
+constexpr StateVector<FloatType, UnitsList> operator+(
+    const StateVector<FloatType, UnitsList>& lhs,
+    const StateVector<FloatType, UnitsList>& rhs) noexcept(true)
+{
+  auto result = lhs;
+  return result += rhs;
+}
+
+/// @brief
+/// @tparam FloatType
+/// @tparam UnitsList
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename FloatType, typename UnitsList>
+constexpr StateVector<FloatType, UnitsList> operator-(
+    const StateVector<FloatType, UnitsList>& lhs,
+    const StateVector<FloatType, UnitsList>& rhs) noexcept(true)
+{
+  auto result = lhs;
+  return result -= rhs;
+}
+
+/// @brief  Template class to represent a fixed-size matrix of quantities whose entry (i, j) has
+///         the physical units Row_i * Column_j. This single rule covers the matrices of an
+///         estimation filter:
+///
+///         - A covariance of a state with units U has entries U_i * U_j,
+///           i.e. QuantityMatrix<F, U, U>. See CovarianceMatrix.
+///         - A Jacobian of an output Y w.r.t. an input X has entries Y_i / X_j,
+///           i.e. QuantityMatrix<F, Y, X⁻¹>. See JacobianMatrix.
+///
+///         Products, transposes and inverses compose the row / column units accordingly and are
+///         rejected at compile time if the inner units do not cancel. Since units of equivalent
+///         scale cancel exactly, the arithmetic runs on the dense aligned block of magnitudes with
+///         no conversions at all.
+///
+/// @tparam FloatType_          Floating point representation of the magnitudes.
+///
+/// @tparam RowUnitsList_       @class PhysicalUnitsList associated with the rows.
+///
+/// @tparam ColumnUnitsList_    @class PhysicalUnitsList associated with the columns.
+
+template<typename FloatType_, typename RowUnitsList_, typename ColumnUnitsList_>
+class QuantityMatrix
+{
+public:
+  using FloatType = FloatType_;
+  using RowUnitsList = RowUnitsList_;
+  using ColumnUnitsList = ColumnUnitsList_;
+  using SelfType = QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList>;
+
+  static constexpr std::size_t kRows = RowUnitsList::kSize;
+  static constexpr std::size_t kColumns = ColumnUnitsList::kSize;
+
+  /// Type of the entry at (@tparam Row, @tparam Column).
+  template<std::size_t Row, std::size_t Column>
+  using Entry = AffineQuantity<
+      typename MultiplyPhysicalUnits<
+          typename detail::ListAt<RowUnitsList, Row>::Type,
+          typename detail::ListAt<ColumnUnitsList, Column>::Type,
+          PreserveScalePolicy>::Result,
+      FloatType>;
+
+  /// @brief  Default constructor with 0 initialization.
+  constexpr QuantityMatrix() noexcept(true): mValues{} {}
+
+  /// @brief  Identity matrix. Only available if every diagonal entry is dimensionless with a
+  ///         scale of exactly 1, e.g. for Jacobians of a state w.r.t. itself.
+  /// @return
+  static constexpr SelfType identity() noexcept(true)
+  {
+    static_assert(kRows == kColumns, "Identity is only defined for square matrices.");
+    static_assert(
+        detail::AreEquivalentLists<
+            RowUnitsList,
+            typename InversePhysicalUnitsList<ColumnUnitsList>::Result>::value,
+        "Identity requires dimensionless diagonal entries of unit scale.");
+
+    SelfType result;
+    for(std::size_t index = 0; index < kRows; ++index)
+    {
+      result.mValues[index * kColumns + index] = FloatType(1);
+    }
+
+    return result;
+  }
+
+  /// @brief  Method to access the entry at (@tparam Row, @tparam Column).
+  /// @return
+  template<std::size_t Row, std::size_t Column>
+  constexpr Entry<Row, Column> get() const noexcept(true)
+  {
+    static_assert(Row < kRows and Column < kColumns, "Requested entry is out of bounds.");
+    return Entry<Row, Column>(mValues[Row * kColumns + Column]);
+  }
+
+  /// @brief  Method to set the entry at (@tparam Row, @tparam Column). Quantities of compatible
+  ///         physical units are converted implicitly.
+  /// @param  quantity
+  template<std::size_t Row, std::size_t Column>
+  constexpr void set(const Entry<Row, Column> quantity) noexcept(true)
+  {
+    static_assert(Row < kRows and Column < kColumns, "Requested entry is out of bounds.");
+    mValues[Row * kColumns + Column] = quantity.scalar();
+  }
+
+  /// @brief  Raw row-major access to the magnitudes for use in numerical kernels.
+  /// @return
+  constexpr FloatType* data() noexcept(true)
+  {
+    return mValues;
+  }
+
+  /// @brief  Raw row-major access to the magnitudes for use in numerical kernels.
+  /// @return
+  constexpr const FloatType* data() const noexcept(true)
+  {
+    return mValues;
+  }
+
+  /// @brief  Transpose. Entry (j, i) of the result has the units Column_j * Row_i.
+  /// @return
+  constexpr QuantityMatrix<FloatType, ColumnUnitsList, RowUnitsList> transpose() const
+      noexcept(true)
+  {
+    QuantityMatrix<FloatType, ColumnUnitsList, RowUnitsList> result;
+    for(std::size_t row = 0; row < kRows; ++row)
+    {
+      for(std::size_t column = 0; column < kColumns; ++column)
+      {
+        result.data()[column * kRows + row] = mValues[row * kColumns + column];
+      }
+    }
+
+    return result;
+  }
+
+  /// @brief  Inverse computed by Gauss-Jordan elimination with partial pivoting. Entry (i, j) of
+  ///         the result has the units 1 / (Column_i * Row_j). The result of inverting a singular
+  ///         matrix contains non-finite values.
+  /// @return
+  QuantityMatrix<
+      FloatType,
+      typename InversePhysicalUnitsList<ColumnUnitsList>::Result,
+      typename InversePhysicalUnitsList<RowUnitsList>::Result>
+  inverse() const noexcept(true)
+  {
+    static_assert(kRows == kColumns, "Inverse is only defined for square matrices.");
+
+    FloatType work[kRows * kColumns];
+    QuantityMatrix<
+        FloatType,
+        typename InversePhysicalUnitsList<ColumnUnitsList>::Result,
+        typename InversePhysicalUnitsList<RowUnitsList>::Result>
+        result;
+
+    FloatType* const inverse = result.data();
+    for(std::size_t index = 0; index < kRows * kColumns; ++index)
+    {
+      work[index] = mValues[index];
+      inverse[index] = FloatType(0);
+    }
+
+    for(std::size_t index = 0; index < kRows; ++index)
+    {
+      inverse[index * kColumns + index] = FloatType(1);
+    }
+
+    for(std::size_t pivot = 0; pivot < kRows; ++pivot)
+    {
+      std::size_t best = pivot;
+      for(std::size_t row = pivot + 1; row < kRows; ++row)
+      {
+        if(detail::magnitude(work[row * kColumns + pivot]) >
+           detail::magnitude(work[best * kColumns + pivot]))
+        {
+          best = row;
+        }
+      }
+
+      for(std::size_t column = 0; column < kColumns; ++column)
+      {
+        std::swap(work[pivot * kColumns + column], work[best * kColumns + column]);
+        std::swap(inverse[pivot * kColumns + column], inverse[best * kColumns + column]);
+      }
+
+      const FloatType reciprocal = FloatType(1) / work[pivot * kColumns + pivot];
+      for(std::size_t column = 0; column < kColumns; ++column)
+      {
+        work[pivot * kColumns + column] *= reciprocal;
+        inverse[pivot * kColumns + column] *= reciprocal;
+      }
+
+      for(std::size_t row = 0; row < kRows; ++row)
+      {
+        if(row == pivot)
+        {
+          continue;
+        }
+
+        const FloatType factor = work[row * kColumns + pivot];
+        for(std::size_t column = 0; column < kColumns; ++column)
+        {
+          work[row * kColumns + column] -= factor * work[pivot * kColumns + column];
+          inverse[row * kColumns + column] -= factor * inverse[pivot * kColumns + column];
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /// @brief  Addition assignment operator.
+  /// @param  rhs
+  /// @return
+  constexpr SelfType& operator+=(const SelfType& rhs) noexcept(true)
+  {
+    for(std::size_t index = 0; index < kRows * kColumns; ++index)
+    {
+      mValues[index] += rhs.mValues[index];
+    }
+
+    return *this;
+  }
+
+  /// @brief  Subtraction assignment operator.
+  /// @param  rhs
+  /// @return
+  constexpr SelfType& operator-=(const SelfType& rhs) noexcept(true)
+  {
+    for(std::size_t index = 0; index < kRows * kColumns; ++index)
+    {
+      mValues[index] -= rhs.mValues[index];
+    }
+
+    return *this;
+  }
+
+private:
+  alignas(64) FloatType mValues[kRows * kColumns];
+};
+
+/// Covariance of a state whose elements have the physical units in @tparam UnitsList.
+template<typename FloatType, typename UnitsList>
+using CovarianceMatrix = QuantityMatrix<FloatType, UnitsList, UnitsList>;
+
+/// Jacobian of an output with physical units @tparam OutputUnitsList w.r.t. an input with physical
+/// units @tparam InputUnitsList.
+template<typename FloatType, typename OutputUnitsList, typename InputUnitsList>
+using JacobianMatrix = QuantityMatrix<
+    FloatType,
+    OutputUnitsList,
+    typename InversePhysicalUnitsList<InputUnitsList>::Result>;
+
+/// @brief
+/// @tparam FloatType
+/// @tparam RowUnitsList
+/// @tparam ColumnUnitsList
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename FloatType, typename RowUnitsList, typename ColumnUnitsList>
+constexpr QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList> operator+(
+    const QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList>& lhs,
+    const QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList>& rhs) noexcept(true)
+{
+  auto result = lhs;
+  return result += rhs;
+}
+
+/// @brief
+/// @tparam FloatType
+/// @tparam RowUnitsList
+/// @tparam ColumnUnitsList
+/// @param lhs
+/// @param rhs
+/// @return
+template<typename FloatType, typename RowUnitsList, typename ColumnUnitsList>
+constexpr QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList> operator-(
+    const QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList>& lhs,
+    const QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList>& rhs) noexcept(true)
+{
+  auto result = lhs;
+  return result -= rhs;
+}
+
+/// @brief  Matrix product. The column units of the LHS and the row units of the RHS are required
+///         to cancel i.e. LhsColumn_k * RhsRow_k must be dimensionless with a scale of exactly 1.
+/// @tparam FloatType
+/// @tparam LhsRowUnitsList
+/// @tparam LhsColumnUnitsList
+/// @tparam RhsRowUnitsList
+/// @tparam RhsColumnUnitsList
+/// @param lhs
+/// @param rhs
+/// @return
+template<
+    typename FloatType,
+    typename LhsRowUnitsList,
+    typename LhsColumnUnitsList,
+    typename RhsRowUnitsList,
+    typename RhsColumnUnitsList>
+constexpr QuantityMatrix<FloatType, LhsRowUnitsList, RhsColumnUnitsList> operator*(
+    const QuantityMatrix<FloatType, LhsRowUnitsList, LhsColumnUnitsList>& lhs,
+    const QuantityMatrix<FloatType, RhsRowUnitsList, RhsColumnUnitsList>& rhs) noexcept(true)
+{
+  static_assert(
+      detail::AreEquivalentLists<
+          LhsColumnUnitsList,
+          typename InversePhysicalUnitsList<RhsRowUnitsList>::Result>::value,
+      "Invalid request to multiply quantity matrices whose inner physical units do not cancel.");
+
+  constexpr std::size_t kRows = LhsRowUnitsList::kSize;
+  constexpr std::size_t kInner = LhsColumnUnitsList::kSize;
+  constexpr std::size_t kColumns = RhsColumnUnitsList::kSize;
+
+  QuantityMatrix<FloatType, LhsRowUnitsList, RhsColumnUnitsList> result;
+  for(std::size_t row = 0; row < kRows; ++row)
+  {
+    for(std::size_t inner = 0; inner < kInner; ++inner)
+    {
+      const FloatType factor = lhs.data()[row * kInner + inner];
+      for(std::size_t column = 0; column < kColumns; ++column)
+      {
+        result.data()[row * kColumns + column] += factor * rhs.data()[inner * kColumns + column];
+      }
+    }
+  }
+
+  return result;
+}
+
+/// @brief  Matrix-vector product. The column units of the matrix and the units of the vector are
+///         required to cancel i.e. Column_k * Vector_k must be dimensionless with a scale of
+///         exactly 1.
+/// @tparam FloatType
+/// @tparam RowUnitsList
+/// @tparam ColumnUnitsList
+/// @tparam VectorUnitsList
+/// @param lhs
+/// @param rhs
+/// @return
+template<
+    typename FloatType,
+    typename RowUnitsList,
+    typename ColumnUnitsList,
+    typename VectorUnitsList>
+constexpr StateVector<FloatType, RowUnitsList> operator*(
+    const QuantityMatrix<FloatType, RowUnitsList, ColumnUnitsList>& lhs,
+    const StateVector<FloatType, VectorUnitsList>& rhs) noexcept(true)
+{
+  static_assert(
+      detail::AreEquivalentLists<
+          ColumnUnitsList,
+          typename InversePhysicalUnitsList<VectorUnitsList>::Result>::value,
+      "Invalid request to multiply a quantity matrix and a state vector whose physical units do "
+      "not cancel.");
+
+  constexpr std::size_t kRows = RowUnitsList::kSize;
+  constexpr std::size_t kColumns = ColumnUnitsList::kSize;
+
+  StateVector<FloatType, RowUnitsList> result;
+  for(std::size_t row = 0; row < kRows; ++row)
+  {
+    FloatType sum = FloatType(0);
+    for(std::size_t column = 0; column < kColumns; ++column)
+    {
+      sum += lhs.data()[row * kColumns + column] * rhs.data()[column];
+    }
+
+    result.data()[row] = sum;
+  }
+
+  return result;
+}
+
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,674 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__AVX2__) or defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace units
+{
+
+namespace detail
+{
+
+/// Rounds half away from zero and saturates to the range of @tparam StorageInt. NaN maps to 0.
+/// The SIMD kernels below implement the exact same arithmetic.
+template<typename StorageInt, typename FloatType>
+constexpr StorageInt saturatingRound(const FloatType value) noexcept(true)
+{
+  if(not(value == value))
+  {
+    return StorageInt(0);
+  }
+
+  const FloatType rounded = value < FloatType(0) ? value - FloatType(0.5) : value + FloatType(0.5);
+
+  if(rounded >= FloatType(std::numeric_limits<StorageInt>::max()))
+  {
+    return std::numeric_limits<StorageInt>::max();
+  }
+
+  if(rounded <= FloatType(std::numeric_limits<StorageInt>::min()))
+  {
+    return std::numeric_limits<StorageInt>::min();
+  }
+
+  return static_cast<StorageInt>(rounded);
+}
+
+template<typename StorageInt, typename FloatType>
+inline void quantizeKernel(
+    const FloatType* const values,
+    const std::size_t size,
+    const FloatType scale,
+    StorageInt* const counts) noexcept(true)
+{
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    counts[index] = saturatingRound<StorageInt>(values[index] * scale);
+  }
+}
+
+template<typename StorageInt, typename FloatType>
+inline void dequantizeKernel(
+    const StorageInt* const counts,
+    const std::size_t size,
+    const FloatType scale,
+    FloatType* const values) noexcept(true)
+{
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    values[index] = FloatType(counts[index]) * scale;
+  }
+}
+
+#if defined(__AVX512F__)
+
+// GCC 12 flags the _mm512_undefined_* placeholders inside its own AVX-512 intrinsics.
+#if defined(__GNUC__) and not defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/// Zeroes NaN and adds 0.5 with the sign of @param scaled, i.e. saturatingRound up to its clamp.
+inline __m512 roundHalfAwayFromZero(const __m512 scaled) noexcept(true)
+{
+  const __m512 ordered =
+      _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(scaled, scaled, _CMP_ORD_Q), scaled);
+  const __m512 offset = _mm512_castsi512_ps(_mm512_or_si512(
+      _mm512_and_si512(_mm512_castps_si512(ordered), _mm512_set1_epi32(INT32_MIN)),
+      _mm512_castps_si512(_mm512_set1_ps(0.5F))));
+
+  return _mm512_add_ps(ordered, offset);
+}
+
+inline __m512d roundHalfAwayFromZero(const __m512d scaled) noexcept(true)
+{
+  const __m512d ordered =
+      _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(scaled, scaled, _CMP_ORD_Q), scaled);
+  const __m512d offset = _mm512_castsi512_pd(_mm512_or_si512(
+      _mm512_and_si512(_mm512_castpd_si512(ordered), _mm512_set1_epi64(INT64_MIN)),
+      _mm512_castpd_si512(_mm512_set1_pd(0.5))));
+
+  return _mm512_add_pd(ordered, offset);
+}
+
+inline void quantizeKernel(
+    const float* const values,
+    const std::size_t size,
+    const float scale,
+    std::int16_t* const counts) noexcept(true)
+{
+  const __m512 factor = _mm512_set1_ps(scale);
+  const __m512 lowest = _mm512_set1_ps(-32768.0F);
+  const __m512 highest = _mm512_set1_ps(32767.0F);
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    const __m512 rounded =
+        roundHalfAwayFromZero(_mm512_mul_ps(_mm512_loadu_ps(values + index), factor));
+    const __m512 clamped = _mm512_max_ps(_mm512_min_ps(rounded, highest), lowest);
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(counts + index),
+        _mm512_cvtsepi32_epi16(_mm512_cvttps_epi32(clamped)));
+  }
+
+  quantizeKernel<std::int16_t, float>(values + index, size - index, scale, counts + index);
+}
+
+inline void quantizeKernel(
+    const double* const values,
+    const std::size_t size,
+    const double scale,
+    std::int16_t* const counts) noexcept(true)
+{
+  const __m512d factor = _mm512_set1_pd(scale);
+  const __m512d lowest = _mm512_set1_pd(-32768.0);
+  const __m512d highest = _mm512_set1_pd(32767.0);
+
+  const auto round = [&](const __m512d value)
+  {
+    const __m512d rounded = roundHalfAwayFromZero(_mm512_mul_pd(value, factor));
+
+    return _mm512_cvttpd_epi32(_mm512_max_pd(_mm512_min_pd(rounded, highest), lowest));
+  };
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    const __m512i joined = _mm512_inserti64x4(
+        _mm512_castsi256_si512(round(_mm512_loadu_pd(values + index))),
+        round(_mm512_loadu_pd(values + index + 8)),
+        1);
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(counts + index), _mm512_cvtsepi32_epi16(joined));
+  }
+
+  quantizeKernel<std::int16_t, double>(values + index, size - index, scale, counts + index);
+}
+
+inline void quantizeKernel(
+    const float* const values,
+    const std::size_t size,
+    const float scale,
+    std::int32_t* const counts) noexcept(true)
+{
+  // 2^31 is the float nearest to INT32_MAX and is out of range, so it saturates via a mask.
+  const __m512 factor = _mm512_set1_ps(scale);
+  const __m512 lowest = _mm512_set1_ps(-2147483648.0F);
+  const __m512 overflow = _mm512_set1_ps(2147483648.0F);
+  const __m512i highest = _mm512_set1_epi32(INT32_MAX);
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    const __m512 rounded =
+        roundHalfAwayFromZero(_mm512_mul_ps(_mm512_loadu_ps(values + index), factor));
+    const __m512i truncated = _mm512_cvttps_epi32(_mm512_max_ps(rounded, lowest));
+
+    _mm512_storeu_si512(
+        counts + index,
+        _mm512_mask_mov_epi32(
+            truncated, _mm512_cmp_ps_mask(rounded, overflow, _CMP_GE_OQ), highest));
+  }
+
+  quantizeKernel<std::int32_t, float>(values + index, size - index, scale, counts + index);
+}
+
+inline void quantizeKernel(
+    const double* const values,
+    const std::size_t size,
+    const double scale,
+    std::int32_t* const counts) noexcept(true)
+{
+  const __m512d factor = _mm512_set1_pd(scale);
+  const __m512d lowest = _mm512_set1_pd(-2147483648.0);
+  const __m512d highest = _mm512_set1_pd(2147483647.0);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m512d rounded =
+        roundHalfAwayFromZero(_mm512_mul_pd(_mm512_loadu_pd(values + index), factor));
+    const __m512d clamped = _mm512_max_pd(_mm512_min_pd(rounded, highest), lowest);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(counts + index), _mm512_cvttpd_epi32(clamped));
+  }
+
+  quantizeKernel<std::int32_t, double>(values + index, size - index, scale, counts + index);
+}
+
+inline void dequantizeKernel(
+    const std::int16_t* const counts,
+    const std::size_t size,
+    const float scale,
+    float* const values) noexcept(true)
+{
+  const __m512 factor = _mm512_set1_ps(scale);
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    const __m512i widened = _mm512_cvtepi16_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counts + index)));
+
+    _mm512_storeu_ps(values + index, _mm512_mul_ps(_mm512_cvtepi32_ps(widened), factor));
+  }
+
+  dequantizeKernel<std::int16_t, float>(counts + index, size - index, scale, values + index);
+}
+
+inline void dequantizeKernel(
+    const std::int16_t* const counts,
+    const std::size_t size,
+    const double scale,
+    double* const values) noexcept(true)
+{
+  const __m512d factor = _mm512_set1_pd(scale);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256i widened = _mm256_cvtepi16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(counts + index)));
+
+    _mm512_storeu_pd(values + index, _mm512_mul_pd(_mm512_cvtepi32_pd(widened), factor));
+  }
+
+  dequantizeKernel<std::int16_t, double>(counts + index, size - index, scale, values + index);
+}
+
+inline void dequantizeKernel(
+    const std::int32_t* const counts,
+    const std::size_t size,
+    const float scale,
+    float* const values) noexcept(true)
+{
+  const __m512 factor = _mm512_set1_ps(scale);
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    const __m512i loaded = _mm512_loadu_si512(counts + index);
+
+    _mm512_storeu_ps(values + index, _mm512_mul_ps(_mm512_cvtepi32_ps(loaded), factor));
+  }
+
+  dequantizeKernel<std::int32_t, float>(counts + index, size - index, scale, values + index);
+}
+
+inline void dequantizeKernel(
+    const std::int32_t* const counts,
+    const std::size_t size,
+    const double scale,
+    double* const values) noexcept(true)
+{
+  const __m512d factor = _mm512_set1_pd(scale);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counts + index));
+
+    _mm512_storeu_pd(values + index, _mm512_mul_pd(_mm512_cvtepi32_pd(loaded), factor));
+  }
+
+  dequantizeKernel<std::int32_t, double>(counts + index, size - index, scale, values + index);
+}
+
+#if defined(__GNUC__) and not defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#elif defined(__AVX2__)
+
+/// Zeroes NaN and adds 0.5 with the sign of @param scaled, i.e. saturatingRound up to its clamp.
+inline __m256 roundHalfAwayFromZero(const __m256 scaled) noexcept(true)
+{
+  const __m256 ordered = _mm256_and_ps(scaled, _mm256_cmp_ps(scaled, scaled, _CMP_ORD_Q));
+  const __m256 offset =
+      _mm256_or_ps(_mm256_and_ps(ordered, _mm256_set1_ps(-0.0F)), _mm256_set1_ps(0.5F));
+
+  return _mm256_add_ps(ordered, offset);
+}
+
+inline __m256d roundHalfAwayFromZero(const __m256d scaled) noexcept(true)
+{
+  const __m256d ordered = _mm256_and_pd(scaled, _mm256_cmp_pd(scaled, scaled, _CMP_ORD_Q));
+  const __m256d offset =
+      _mm256_or_pd(_mm256_and_pd(ordered, _mm256_set1_pd(-0.0)), _mm256_set1_pd(0.5));
+
+  return _mm256_add_pd(ordered, offset);
+}
+
+inline void quantizeKernel(
+    const float* const values,
+    const std::size_t size,
+    const float scale,
+    std::int16_t* const counts) noexcept(true)
+{
+  const __m256 factor = _mm256_set1_ps(scale);
+  const __m256 lowest = _mm256_set1_ps(-32768.0F);
+  const __m256 highest = _mm256_set1_ps(32767.0F);
+
+  const auto round = [&](const __m256 value)
+  {
+    const __m256 rounded = roundHalfAwayFromZero(_mm256_mul_ps(value, factor));
+
+    return _mm256_cvttps_epi32(_mm256_max_ps(_mm256_min_ps(rounded, highest), lowest));
+  };
+
+  std::size_t index = 0;
+  for(; index + 16 <= size; index += 16)
+  {
+    // packs interleaves the 128-bit lanes of its operands; the permute restores the order.
+    const __m256i packed = _mm256_packs_epi32(
+        round(_mm256_loadu_ps(values + index)),
+        round(_mm256_loadu_ps(values + index + 8)));
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(counts + index), _mm256_permute4x64_epi64(packed, 0xD8));
+  }
+
+  quantizeKernel<std::int16_t, float>(values + index, size - index, scale, counts + index);
+}
+
+inline void quantizeKernel(
+    const double* const values,
+    const std::size_t size,
+    const double scale,
+    std::int16_t* const counts) noexcept(true)
+{
+  const __m256d factor = _mm256_set1_pd(scale);
+  const __m256d lowest = _mm256_set1_pd(-32768.0);
+  const __m256d highest = _mm256_set1_pd(32767.0);
+
+  const auto round = [&](const __m256d value)
+  {
+    const __m256d rounded = roundHalfAwayFromZero(_mm256_mul_pd(value, factor));
+
+    return _mm256_cvttpd_epi32(_mm256_max_pd(_mm256_min_pd(rounded, highest), lowest));
+  };
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m128i packed = _mm_packs_epi32(
+        round(_mm256_loadu_pd(values + index)),
+        round(_mm256_loadu_pd(values + index + 4)));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(counts + index), packed);
+  }
+
+  quantizeKernel<std::int16_t, double>(values + index, size - index, scale, counts + index);
+}
+
+inline void quantizeKernel(
+    const float* const values,
+    const std::size_t size,
+    const float scale,
+    std::int32_t* const counts) noexcept(true)
+{
+  // 2^31 is the float nearest to INT32_MAX and is out of range, so it saturates via a blend.
+  const __m256 factor = _mm256_set1_ps(scale);
+  const __m256 lowest = _mm256_set1_ps(-2147483648.0F);
+  const __m256 overflow = _mm256_set1_ps(2147483648.0F);
+  const __m256i highest = _mm256_set1_epi32(INT32_MAX);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256 rounded =
+        roundHalfAwayFromZero(_mm256_mul_ps(_mm256_loadu_ps(values + index), factor));
+    const __m256i truncated = _mm256_cvttps_epi32(_mm256_max_ps(rounded, lowest));
+    const __m256i saturated = _mm256_castps_si256(_mm256_cmp_ps(rounded, overflow, _CMP_GE_OQ));
+
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(counts + index),
+        _mm256_blendv_epi8(truncated, highest, saturated));
+  }
+
+  quantizeKernel<std::int32_t, float>(values + index, size - index, scale, counts + index);
+}
+
+inline void quantizeKernel(
+    const double* const values,
+    const std::size_t size,
+    const double scale,
+    std::int32_t* const counts) noexcept(true)
+{
+  const __m256d factor = _mm256_set1_pd(scale);
+  const __m256d lowest = _mm256_set1_pd(-2147483648.0);
+  const __m256d highest = _mm256_set1_pd(2147483647.0);
+
+  std::size_t index = 0;
+  for(; index + 4 <= size; index += 4)
+  {
+    const __m256d rounded =
+        roundHalfAwayFromZero(_mm256_mul_pd(_mm256_loadu_pd(values + index), factor));
+    const __m256d clamped = _mm256_max_pd(_mm256_min_pd(rounded, highest), lowest);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(counts + index), _mm256_cvttpd_epi32(clamped));
+  }
+
+  quantizeKernel<std::int32_t, double>(values + index, size - index, scale, counts + index);
+}
+
+inline void dequantizeKernel(
+    const std::int16_t* const counts,
+    const std::size_t size,
+    const float scale,
+    float* const values) noexcept(true)
+{
+  const __m256 factor = _mm256_set1_ps(scale);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256i widened =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(counts + index)));
+
+    _mm256_storeu_ps(values + index, _mm256_mul_ps(_mm256_cvtepi32_ps(widened), factor));
+  }
+
+  dequantizeKernel<std::int16_t, float>(counts + index, size - index, scale, values + index);
+}
+
+inline void dequantizeKernel(
+    const std::int16_t* const counts,
+    const std::size_t size,
+    const double scale,
+    double* const values) noexcept(true)
+{
+  const __m256d factor = _mm256_set1_pd(scale);
+
+  std::size_t index = 0;
+  for(; index + 4 <= size; index += 4)
+  {
+    const __m128i widened =
+        _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(counts + index)));
+
+    _mm256_storeu_pd(values + index, _mm256_mul_pd(_mm256_cvtepi32_pd(widened), factor));
+  }
+
+  dequantizeKernel<std::int16_t, double>(counts + index, size - index, scale, values + index);
+}
+
+inline void dequantizeKernel(
+    const std::int32_t* const counts,
+    const std::size_t size,
+    const float scale,
+    float* const values) noexcept(true)
+{
+  const __m256 factor = _mm256_set1_ps(scale);
+
+  std::size_t index = 0;
+  for(; index + 8 <= size; index += 8)
+  {
+    const __m256i loaded = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counts + index));
+
+    _mm256_storeu_ps(values + index, _mm256_mul_ps(_mm256_cvtepi32_ps(loaded), factor));
+  }
+
+  dequantizeKernel<std::int32_t, float>(counts + index, size - index, scale, values + index);
+}
+
+inline void dequantizeKernel(
+    const std::int32_t* const counts,
+    const std::size_t size,
+    const double scale,
+    double* const values) noexcept(true)
+{
+  const __m256d factor = _mm256_set1_pd(scale);
+
+  std::size_t index = 0;
+  for(; index + 4 <= size; index += 4)
+  {
+    const __m128i loaded = _mm_loadu_si128(reinterpret_cast<const __m128i*>(counts + index));
+
+    _mm256_storeu_pd(values + index, _mm256_mul_pd(_mm256_cvtepi32_pd(loaded), factor));
+  }
+
+  dequantizeKernel<std::int32_t, double>(counts + index, size - index, scale, values + index);
+}
+
+#endif
+
+} // End of namespace detail.
+
+/// @brief  Template class to represent a quantity stored as an integer count of a fixed least
+///         significant bit, as delivered by sensors and ADCs. The LSB is folded into the scale of
+///         the physical units of a single count, so a sample costs sizeof(StorageInt) bytes while
+///         its physical units remain exact.
+///
+///         EG: QuantizedQuantity<MetresPhysicalUnit, std::int16_t, std::ratio<1, 10000>> stores
+///             a length in counts of 0.1 mm in 2 bytes.
+///
+/// @tparam PhysicalUnits_  Physical units in which the LSB is expressed.
+///
+/// @tparam StorageInt_     Integer type of the stored count.
+///
+/// @tparam LSBRatio_       std::ratio of the value of one count in @tparam PhysicalUnits_.
+
+template<typename PhysicalUnits_, typename StorageInt_, typename LSBRatio_>
+class QuantizedQuantity
+{
+public:
+  using PhysicalUnits = PhysicalUnits_;
+  using StorageInt = StorageInt_;
+  using LSBRatio = LSBRatio_;
+  using SelfType = QuantizedQuantity<PhysicalUnits, StorageInt, LSBRatio>;
+
+  static_assert(
+      std::numeric_limits<StorageInt>::is_integer,
+      "The storage of a quantized quantity is required to be an integer type.");
+
+  /// Physical units of a single count.
+  using LSBPhysicalUnits = units::PhysicalUnits<
+      typename PhysicalUnits::PhysicalDimensions,
+      typename MultiplyScales<typename PhysicalUnits::Scale, LSBRatio>::Result>;
+
+  /// @brief  Default constructor with 0 initialization.
+  constexpr QuantizedQuantity() noexcept(true): mCount(0) {}
+
+  /// @brief  Construction from a raw count.
+  /// @param  count
+  explicit constexpr QuantizedQuantity(const StorageInt count) noexcept(true): mCount(count) {}
+
+  /// @brief  Quantizes a quantity of compatible physical units. The value is rounded half away
+  ///         from zero to the nearest count and saturated to the range of StorageInt; NaN maps
+  ///         to 0.
+  /// @tparam RhsPhysicalUnits
+  /// @tparam FloatType
+  /// @tparam ConversionPolicy
+  /// @param  quantity
+  /// @return
+  template<typename RhsPhysicalUnits, typename FloatType, typename ConversionPolicy>
+  static constexpr SelfType quantize(
+      const AffineQuantity<RhsPhysicalUnits, FloatType, ConversionPolicy> quantity) noexcept(true)
+  {
+    return SelfType(detail::saturatingRound<StorageInt>(
+        quantity.scalar() *
+        PhysicalUnitsScale<LSBPhysicalUnits, RhsPhysicalUnits, FloatType>::kScale));
+  }
+
+  /// @brief  Dequantizes into the affine quantity @tparam Target. The LSB and the conversion into
+  ///         the physical units of the target are folded into a single multiplication.
+  /// @tparam Target
+  /// @return
+  template<typename Target>
+  constexpr Target dequantize() const noexcept(true)
+  {
+    using FloatType = typename Target::FloatType;
+
+    return Target(
+        FloatType(mCount) *
+        PhysicalUnitsScale<typename Target::PhysicalUnits, LSBPhysicalUnits, FloatType>::kScale);
+  }
+
+  /// @brief  Method to access the raw count.
+  /// @return
+  constexpr StorageInt count() const noexcept(true)
+  {
+    return mCount;
+  }
+
+private:
+  StorageInt mCount;
+};
+
+/// @brief  Bulk quantization of @param size quantities into counts of @tparam Quantized. Equivalent
+///         to calling Quantized::quantize on every element. int16 and int32 counts from float and
+///         double are vectorized with AVX2 / AVX-512 when enabled at compile time.
+/// @tparam Quantized
+/// @tparam PhysicalUnits
+/// @tparam FloatType
+/// @tparam ConversionPolicy
+/// @param  input
+/// @param  size
+/// @param  output
+template<typename Quantized, typename PhysicalUnits, typename FloatType, typename ConversionPolicy>
+void quantize(
+    const AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>* const input,
+    const std::size_t size,
+    Quantized* const output) noexcept(true)
+{
+  using StorageInt = typename Quantized::StorageInt;
+
+  static_assert(
+      sizeof(Quantized) == sizeof(StorageInt) and
+          sizeof(AffineQuantity<PhysicalUnits, FloatType, ConversionPolicy>) == sizeof(FloatType),
+      "Bulk quantization requires quantities to be laid out as their underlying representation.");
+
+  detail::quantizeKernel(
+      reinterpret_cast<const FloatType*>(input),
+      size,
+      PhysicalUnitsScale<typename Quantized::LSBPhysicalUnits, PhysicalUnits, FloatType>::kScale,
+      reinterpret_cast<StorageInt*>(output));
+}
+
+/// @brief  Bulk dequantization of @param size counts into the affine quantity @tparam Target.
+///         Equivalent to calling dequantize<Target>() on every element. int16 and int32 counts to
+///         float and double are vectorized with AVX2 / AVX-512 when enabled at compile time.
+/// @tparam Target
+/// @tparam PhysicalUnits
+/// @tparam StorageInt
+/// @tparam LSBRatio
+/// @param  input
+/// @param  size
+/// @param  output
+template<typename Target, typename PhysicalUnits, typename StorageInt, typename LSBRatio>
+void dequantize(
+    const QuantizedQuantity<PhysicalUnits, StorageInt, LSBRatio>* const input,
+    const std::size_t size,
+    Target* const output) noexcept(true)
+{
+  using Quantized = QuantizedQuantity<PhysicalUnits, StorageInt, LSBRatio>;
+  using FloatType = typename Target::FloatType;
+
+  static_assert(
+      sizeof(Quantized) == sizeof(StorageInt) and sizeof(Target) == sizeof(FloatType),
+      "Bulk dequantization requires quantities to be laid out as their underlying "
+      "representation.");
+
+  detail::dequantizeKernel(
+      reinterpret_cast<const StorageInt*>(input),
+      size,
+      PhysicalUnitsScale<
+          typename Target::PhysicalUnits,
+          typename Quantized::LSBPhysicalUnits,
+          FloatType>::kScale,
+      reinterpret_cast<FloatType*>(output));
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+namespace units
+{
+
+namespace detail
+{
+
+template<typename...>
+using VoidType = void;
+
+template<typename FloatType, typename = void>
+struct ScalarOf
+{
+  using Type = FloatType;
+};
+
+template<typename FloatType>
+struct ScalarOf<FloatType, VoidType<typename FloatType::value_type>>
+{
+  using Type = typename FloatType::value_type;
+};
+
+} // End of namespace detail.
+
+/// @brief  Describes the representation used to store the magnitude of an affine quantity.
+///
+///         A representation is either a scalar arithmetic type or a type that packs several
+///         scalars (e.g. std::experimental::simd<double>) and exposes them through a nested
+///         value_type. Scale factors are always held as a Scalar and are broadcast by the
+///         representation's own arithmetic, and comparisons return whatever the representation's
+///         comparison operators return, i.e. bool for scalars and a lane mask for SIMD types.
+///
+/// @tparam FloatType_  Representation of the magnitude of an affine quantity.
+
+template<typename FloatType_>
+class RepresentationTraits
+{
+public:
+  using FloatType = FloatType_;
+  using SelfType = RepresentationTraits<FloatType>;
+
+  /// Scalar type of a single lane of the representation.
+  using Scalar = typename detail::ScalarOf<FloatType>::Type;
+
+  /// Result type of comparing two values of the representation.
+  using Mask = decltype(std::declval<FloatType>() == std::declval<FloatType>());
+
+  RepresentationTraits() = delete;
+
+  RepresentationTraits(const RepresentationTraits&) = delete;
+
+  RepresentationTraits(RepresentationTraits&&) = delete;
+
+  ~RepresentationTraits() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,312 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// Streaming resampling of (timestamp, value) series onto a uniform grid. Samples arrive in
+/// batches whose timestamps may use any time unit; the grid is converted into the units of each
+/// batch once, so the per-sample work is comparisons and arithmetic on raw scalars. Output is
+/// gathered into a fixed-size chunk that is handed to a sink whenever it fills up.
+
+namespace units
+{
+
+/// @brief  Resampling method: the value of the latest sample at or before each grid point.
+class ZeroOrderHold
+{
+public:
+  using SelfType = ZeroOrderHold;
+
+  ZeroOrderHold() = delete;
+
+  ZeroOrderHold(const ZeroOrderHold&) = delete;
+
+  ZeroOrderHold(ZeroOrderHold&&) = delete;
+
+  ~ZeroOrderHold() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Resampling method: linear interpolation between the samples around each grid point.
+class LinearInterpolation
+{
+public:
+  using SelfType = LinearInterpolation;
+
+  LinearInterpolation() = delete;
+
+  LinearInterpolation(const LinearInterpolation&) = delete;
+
+  LinearInterpolation(LinearInterpolation&&) = delete;
+
+  ~LinearInterpolation() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Resampling method for grids coarser than the input: the mean of the samples in
+///         (grid point - period, grid point]. The boxcar average is the anti-aliasing low-pass;
+///         it suppresses content above the Nyquist rate of the grid before it is sampled. Grid
+///         points without samples in their period are skipped.
+class Decimation
+{
+public:
+  using SelfType = Decimation;
+
+  Decimation() = delete;
+
+  Decimation(const Decimation&) = delete;
+
+  Decimation(Decimation&&) = delete;
+
+  ~Decimation() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Resamples a series of @tparam ValueQuantity onto the grid start + k * period, expressed
+///         in @tparam TimeQuantity.
+///
+///         Grid points before the first sample are skipped. A grid point is emitted as soon as a
+///         sample past it arrives; the sink receives chunks of at most @tparam ChunkSize points.
+///
+///         EG: Resampler<Seconds, Metres, LinearInterpolation> ranges(Seconds(0.0), Seconds(0.01));
+///             ranges.push(stamps, samples, count, sink);    // stamps may be in milliseconds
+///             ranges.flush(sink);
+///
+///         where sink is callable as sink(const Seconds* times, const Metres* values, size).
+///
+/// @tparam TimeQuantity    Time quantity of the grid and of the output timestamps.
+/// @tparam ValueQuantity   Quantity being resampled.
+/// @tparam Method          ZeroOrderHold, LinearInterpolation or Decimation.
+/// @tparam ChunkSize       Number of output points buffered before they are handed to the sink.
+template<
+    typename TimeQuantity,
+    typename ValueQuantity,
+    typename Method,
+    std::size_t ChunkSize = 256U>
+class Resampler
+{
+public:
+  using SelfType = Resampler<TimeQuantity, ValueQuantity, Method, ChunkSize>;
+  using TimeType = typename TimeQuantity::FloatType;
+  using ValueType = typename ValueQuantity::FloatType;
+
+  static_assert(
+      std::is_same<Time, typename TimeQuantity::PhysicalUnits::PhysicalDimensions>::value,
+      "Resampler grids are expressed in a time quantity.");
+
+  static_assert(
+      std::is_floating_point<TimeType>::value and std::is_floating_point<ValueType>::value,
+      "Resampling requires quantities with a floating point representation.");
+
+  static_assert(ChunkSize > 0U, "Resampler chunks must hold at least one point.");
+
+  /// @brief  Construction of the grid @param start + k * @param period.
+  /// @param  start
+  /// @param  period
+  Resampler(const TimeQuantity start, const TimeQuantity period) noexcept(true):
+      mStart(start.scalar()),
+      mPeriod(period.scalar())
+  {
+  }
+
+  /// @brief  Consumes @param size samples with increasing @param timestamps and the corresponding
+  ///         @param values, passing every filled chunk to @param sink.
+  /// @tparam InputTime   Time quantity of the timestamps of this batch. The grid is converted
+  ///                     into its units once for the whole batch.
+  /// @tparam Sink        Callable as sink(const TimeQuantity*, const ValueQuantity*, std::size_t).
+  /// @param  timestamps
+  /// @param  values
+  /// @param  size
+  /// @param  sink
+  template<typename InputTime, typename Sink>
+  void push(
+      const InputTime* const timestamps,
+      const ValueQuantity* const values,
+      const std::size_t size,
+      Sink&& sink)
+  {
+    static_assert(
+        std::is_same<Time, typename InputTime::PhysicalUnits::PhysicalDimensions>::value,
+        "Resampler timestamps must be time quantities.");
+
+    const TimeType toInput = PhysicalUnitsScale<
+        typename InputTime::PhysicalUnits,
+        typename TimeQuantity::PhysicalUnits,
+        TimeType>::kScale;
+
+    const Grid grid{ mStart * toInput, mPeriod * toInput };
+    TimeType previousTime = mPreviousTime * toInput;
+
+    for(std::size_t index = 0; index < size; ++index)
+    {
+      const TimeType time = static_cast<TimeType>(timestamps[index].scalar());
+      step(grid, previousTime, time, values[index].scalar(), sink, static_cast<Method*>(nullptr));
+      previousTime = time;
+    }
+
+    mPreviousTime = previousTime / toInput;
+  }
+
+  /// @brief  Passes the points gathered so far to @param sink, even if the chunk is not full.
+  /// @tparam Sink
+  /// @param  sink
+  template<typename Sink>
+  void flush(Sink&& sink)
+  {
+    if(mSize > 0U)
+    {
+      sink(
+          static_cast<const TimeQuantity*>(mTimes),
+          static_cast<const ValueQuantity*>(mValues),
+          mSize);
+      mSize = 0;
+    }
+  }
+
+private:
+  /// Grid in the units of the timestamps of the current batch.
+  struct Grid
+  {
+    TimeType mStart;
+    TimeType mPeriod;
+
+    TimeType at(const std::uint64_t index) const noexcept(true)
+    {
+      return mStart + static_cast<TimeType>(index) * mPeriod;
+    }
+  };
+
+  template<typename Sink>
+  void emit(const ValueType value, Sink& sink)
+  {
+    mTimes[mSize] = TimeQuantity(mStart + static_cast<TimeType>(mNext) * mPeriod);
+    mValues[mSize] = ValueQuantity(value);
+
+    if(++mSize == ChunkSize)
+    {
+      flush(sink);
+    }
+  }
+
+  template<typename Sink>
+  void step(
+      const Grid& grid,
+      const TimeType,
+      const TimeType time,
+      const ValueType value,
+      Sink& sink,
+      const ZeroOrderHold*)
+  {
+    for(; grid.at(mNext) < time; ++mNext)
+    {
+      if(mHasPrevious)
+      {
+        emit(mPreviousValue, sink);
+      }
+    }
+
+    mPreviousValue = value;
+    mHasPrevious = true;
+  }
+
+  template<typename Sink>
+  void step(
+      const Grid& grid,
+      const TimeType previousTime,
+      const TimeType time,
+      const ValueType value,
+      Sink& sink,
+      const LinearInterpolation*)
+  {
+    for(TimeType point = grid.at(mNext); point < time; point = grid.at(++mNext))
+    {
+      if(mHasPrevious)
+      {
+        const ValueType fraction =
+            static_cast<ValueType>((point - previousTime) / (time - previousTime));
+        emit(mPreviousValue + (value - mPreviousValue) * fraction, sink);
+      }
+    }
+
+    mPreviousValue = value;
+    mHasPrevious = true;
+  }
+
+  template<typename Sink>
+  void step(
+      const Grid& grid,
+      const TimeType,
+      const TimeType time,
+      const ValueType value,
+      Sink& sink,
+      const Decimation*)
+  {
+    for(; grid.at(mNext) < time; ++mNext)
+    {
+      if(mCount > 0U)
+      {
+        emit(mSum / static_cast<ValueType>(mCount), sink);
+        mSum = 0;
+        mCount = 0;
+      }
+    }
+
+    // Samples older than the period of the pending grid point precede the grid and are dropped.
+    if(time > grid.at(mNext) - grid.mPeriod)
+    {
+      mSum += value;
+      ++mCount;
+    }
+  }
+
+  TimeType mStart;
+  TimeType mPeriod;
+  std::uint64_t mNext = 0;
+
+  TimeType mPreviousTime = 0;
+  ValueType mPreviousValue = 0;
+  bool mHasPrevious = false;
+
+  ValueType mSum = 0;
+  std::size_t mCount = 0;
+
+  TimeQuantity mTimes[ChunkSize];
+  ValueQuantity mValues[ChunkSize];
+  std::size_t mSize = 0;
+};
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,533 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+namespace units
+{
+
+
+/// @brief  Template class to represent a prime raised to an integral exponent. Building block of
+///         @class FactoredScale.
+///
+/// @tparam Prime_      A prime number.
+///
+/// @tparam Exponent_   Non-zero exponent of the prime.
+
+template<std::intmax_t Prime_, std::intmax_t Exponent_>
+class PrimePower
+{
+public:
+  static constexpr std::intmax_t kPrime = Prime_;
+  static constexpr std::intmax_t kExponent = Exponent_;
+  using SelfType = PrimePower<kPrime, kExponent>;
+
+  PrimePower() = delete;
+
+  PrimePower(const PrimePower&) = delete;
+
+  PrimePower(PrimePower&&) = delete;
+
+  ~PrimePower() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Template class to represent a positive rational scale as a product of prime powers.
+///         Unlike std::ratio, multiplying or dividing factored scales only adds or subtracts
+///         exponents and hence never overflows std::intmax_t irrespective of how many scales are
+///         chained together.
+///
+///         EG: The scale of an inch, 254 / 10000, is represented as
+///             FactoredScale<PrimePower<2, -3>, PrimePower<5, -4>, PrimePower<127, 1>>.
+///
+///         Factored scales are produced by MultiplyScales and DivideScales only when the result
+///         does not fit in a std::ratio. They are never needed to be spelled out by hand.
+///
+/// @tparam PrimePowers_    PrimePower<> instances sorted by ascending primes.
+
+template<typename... PrimePowers_>
+class FactoredScale
+{
+public:
+  using SelfType = FactoredScale<PrimePowers_...>;
+
+  FactoredScale() = delete;
+
+  FactoredScale(const FactoredScale&) = delete;
+
+  FactoredScale(FactoredScale&&) = delete;
+
+  ~FactoredScale() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+namespace detail
+{
+
+template<typename Scale>
+struct IsRatio: std::false_type
+{
+};
+
+template<std::intmax_t Num, std::intmax_t Den>
+struct IsRatio<std::ratio<Num, Den>>: std::true_type
+{
+};
+
+constexpr std::intmax_t absolute(const std::intmax_t value)
+{
+  return value < 0 ? -value : value;
+}
+
+constexpr std::intmax_t greatestCommonDivisor(const std::intmax_t lhs, const std::intmax_t rhs)
+{
+  return rhs == 0 ? absolute(lhs) : greatestCommonDivisor(rhs, lhs % rhs);
+}
+
+constexpr bool canMultiply(const std::intmax_t lhs, const std::intmax_t rhs)
+{
+  return lhs == 0 or absolute(rhs) <= INTMAX_MAX / absolute(lhs);
+}
+
+/// Mirrors the cross-reduction performed by std::ratio_multiply to tell, ahead of instantiating it,
+/// whether the product fits in std::intmax_t.
+template<typename Lhs, typename Rhs>
+constexpr bool ratioMultiplyFits()
+{
+  return canMultiply(
+             Lhs::num / greatestCommonDivisor(Lhs::num, Rhs::den),
+             Rhs::num / greatestCommonDivisor(Rhs::num, Lhs::den)) and
+         canMultiply(
+             Lhs::den / greatestCommonDivisor(Rhs::num, Lhs::den),
+             Rhs::den / greatestCommonDivisor(Lhs::num, Rhs::den));
+}
+
+constexpr std::intmax_t smallestPrimeFactor(const std::intmax_t value)
+{
+  if(value % 2 == 0)
+  {
+    return 2;
+  }
+
+  for(std::intmax_t factor = 3; factor <= value / factor; factor += 2)
+  {
+    if(value % factor == 0)
+    {
+      return factor;
+    }
+  }
+
+  return value;
+}
+
+constexpr std::intmax_t multiplicity(std::intmax_t value, const std::intmax_t prime)
+{
+  std::intmax_t count = 0;
+  while(value % prime == 0)
+  {
+    value /= prime;
+    ++count;
+  }
+
+  return count;
+}
+
+constexpr std::intmax_t removeFactor(std::intmax_t value, const std::intmax_t prime)
+{
+  while(value % prime == 0)
+  {
+    value /= prime;
+  }
+
+  return value;
+}
+
+/// Returns prime^exponent for positive exponents and 1 otherwise. Returns 0 when the result does
+/// not fit in std::intmax_t.
+constexpr std::intmax_t positivePower(const std::intmax_t prime, const std::intmax_t exponent)
+{
+  std::intmax_t result = 1;
+  for(std::intmax_t count = 0; count < exponent; ++count)
+  {
+    if(not canMultiply(result, prime))
+    {
+      return 0;
+    }
+
+    result *= prime;
+  }
+
+  return result;
+}
+
+/// Returns the product of the factors or 0 if any factor is 0 or the product overflows.
+template<typename... Factors>
+constexpr std::intmax_t product(const Factors... factors)
+{
+  const std::intmax_t values[] = { 1, factors... };
+
+  std::intmax_t result = 1;
+  for(const auto value: values)
+  {
+    if(value == 0 or not canMultiply(result, value))
+    {
+      return 0;
+    }
+
+    result *= value;
+  }
+
+  return result;
+}
+
+constexpr long double power(const long double base, const std::intmax_t exponent)
+{
+  long double result = 1.0L;
+  for(std::intmax_t count = 0; count < exponent; ++count)
+  {
+    result *= base;
+  }
+
+  return result;
+}
+
+template<typename... Factors>
+constexpr long double floatProduct(const Factors... factors)
+{
+  const long double values[] = { 1.0L, factors... };
+
+  long double result = 1.0L;
+  for(const auto value: values)
+  {
+    result *= value;
+  }
+
+  return result;
+}
+
+template<typename PrimePower, typename Scale>
+struct Prepend;
+
+template<typename PrimePower, typename... PrimePowers>
+struct Prepend<PrimePower, FactoredScale<PrimePowers...>>
+{
+  using Type = FactoredScale<PrimePower, PrimePowers...>;
+};
+
+template<std::intmax_t Value, std::intmax_t Sign, bool = (Value == 1)>
+struct Factorize
+{
+  using Type = FactoredScale<>;
+};
+
+template<std::intmax_t Value, std::intmax_t Sign>
+struct Factorize<Value, Sign, false>
+{
+  static constexpr std::intmax_t kPrime = smallestPrimeFactor(Value);
+
+  using Type = typename Prepend<
+      PrimePower<kPrime, Sign * multiplicity(Value, kPrime)>,
+      typename Factorize<removeFactor(Value, kPrime), Sign>::Type>::Type;
+};
+
+template<typename Lhs, typename Rhs>
+struct Merge;
+
+template<typename Lhs, typename Rhs, int Order>
+struct MergeOrdered;
+
+template<typename... LhsPrimePowers>
+struct Merge<FactoredScale<LhsPrimePowers...>, FactoredScale<>>
+{
+  using Type = FactoredScale<LhsPrimePowers...>;
+};
+
+template<typename RhsHead, typename... RhsTail>
+struct Merge<FactoredScale<>, FactoredScale<RhsHead, RhsTail...>>
+{
+  using Type = FactoredScale<RhsHead, RhsTail...>;
+};
+
+template<typename LhsHead, typename... LhsTail, typename RhsHead, typename... RhsTail>
+struct Merge<FactoredScale<LhsHead, LhsTail...>, FactoredScale<RhsHead, RhsTail...>>
+{
+  using Type = typename MergeOrdered<
+      FactoredScale<LhsHead, LhsTail...>,
+      FactoredScale<RhsHead, RhsTail...>,
+      (LhsHead::kPrime < RhsHead::kPrime) ? -1 : (RhsHead::kPrime < LhsHead::kPrime ? 1 : 0)>::
+      Type;
+};
+
+template<typename LhsHead, typename... LhsTail, typename... RhsPrimePowers>
+struct MergeOrdered<FactoredScale<LhsHead, LhsTail...>, FactoredScale<RhsPrimePowers...>, -1>
+{
+  using Type = typename Prepend<
+      LhsHead,
+      typename Merge<FactoredScale<LhsTail...>, FactoredScale<RhsPrimePowers...>>::Type>::Type;
+};
+
+template<typename... LhsPrimePowers, typename RhsHead, typename... RhsTail>
+struct MergeOrdered<FactoredScale<LhsPrimePowers...>, FactoredScale<RhsHead, RhsTail...>, 1>
+{
+  using Type = typename Prepend<
+      RhsHead,
+      typename Merge<FactoredScale<LhsPrimePowers...>, FactoredScale<RhsTail...>>::Type>::Type;
+};
+
+template<typename LhsHead, typename... LhsTail, typename RhsHead, typename... RhsTail>
+struct MergeOrdered<FactoredScale<LhsHead, LhsTail...>, FactoredScale<RhsHead, RhsTail...>, 0>
+{
+  using Tail = typename Merge<FactoredScale<LhsTail...>, FactoredScale<RhsTail...>>::Type;
+
+  using Type = std::conditional_t<
+      LhsHead::kExponent + RhsHead::kExponent == 0,
+      Tail,
+      typename Prepend<
+          PrimePower<LhsHead::kPrime, LhsHead::kExponent + RhsHead::kExponent>,
+          Tail>::Type>;
+};
+
+template<typename Scale>
+struct Invert;
+
+template<typename... PrimePowers>
+struct Invert<FactoredScale<PrimePowers...>>
+{
+  using Type = FactoredScale<PrimePower<PrimePowers::kPrime, -PrimePowers::kExponent>...>;
+};
+
+template<typename Scale>
+struct ToFactored
+{
+  using Type = Scale;
+};
+
+template<std::intmax_t Num, std::intmax_t Den>
+struct ToFactored<std::ratio<Num, Den>>
+{
+  static_assert(
+      std::ratio<Num, Den>::num > 0,
+      "Physical unit scales are required to be strictly positive.");
+
+  using Type = typename Merge<
+      typename Factorize<std::ratio<Num, Den>::num, 1>::Type,
+      typename Factorize<std::ratio<Num, Den>::den, -1>::Type>::Type;
+};
+
+/// Collapses a factored scale back into a std::ratio whenever its numerator and denominator fit in
+/// std::intmax_t so that unit types stay canonical.
+template<typename Scale>
+struct Normalize;
+
+template<typename... PrimePowers>
+struct Normalize<FactoredScale<PrimePowers...>>
+{
+  static constexpr std::intmax_t kNum =
+      product(positivePower(PrimePowers::kPrime, PrimePowers::kExponent)...);
+
+  static constexpr std::intmax_t kDen =
+      product(positivePower(PrimePowers::kPrime, -PrimePowers::kExponent)...);
+
+  using Type = std::conditional_t<
+      kNum != 0 and kDen != 0,
+      std::ratio<(kNum != 0 ? kNum : 1), (kDen != 0 ? kDen : 1)>,
+      FactoredScale<PrimePowers...>>;
+};
+
+template<typename Lhs, typename Rhs>
+struct MultiplyFactored
+{
+  using Type = typename Normalize<typename Merge<
+      typename ToFactored<Lhs>::Type,
+      typename ToFactored<Rhs>::Type>::Type>::Type;
+};
+
+template<typename Lhs, typename Rhs, bool = ratioMultiplyFits<Lhs, Rhs>()>
+struct MultiplyRatios
+{
+  using Type = std::ratio_multiply<Lhs, Rhs>;
+};
+
+template<typename Lhs, typename Rhs>
+struct MultiplyRatios<Lhs, Rhs, false>: MultiplyFactored<Lhs, Rhs>
+{
+};
+
+template<typename Lhs, typename Rhs, bool = IsRatio<Lhs>::value and IsRatio<Rhs>::value>
+struct MultiplyScales: MultiplyFactored<Lhs, Rhs>
+{
+};
+
+template<typename Lhs, typename Rhs>
+struct MultiplyScales<Lhs, Rhs, true>: MultiplyRatios<Lhs, Rhs>
+{
+};
+
+template<typename Scale>
+struct Reciprocal
+{
+  using Type = typename Invert<typename ToFactored<Scale>::Type>::Type;
+};
+
+template<std::intmax_t Num, std::intmax_t Den>
+struct Reciprocal<std::ratio<Num, Den>>
+{
+  using Type = std::ratio<std::ratio<Num, Den>::den, std::ratio<Num, Den>::num>;
+};
+
+} // End of namespace detail.
+
+/// @brief  Statically computes the product of two scales. The result is a std::ratio whenever it is
+///         representable as one and a @class FactoredScale otherwise.
+/// @tparam Lhs_    std::ratio or FactoredScale.
+/// @tparam Rhs_    std::ratio or FactoredScale.
+
+template<typename Lhs_, typename Rhs_>
+class MultiplyScales
+{
+public:
+  using Lhs = Lhs_;
+  using Rhs = Rhs_;
+  using SelfType = MultiplyScales<Lhs, Rhs>;
+
+  /// Scale resulting from the multiplication of LHS and RHS.
+  using Result = typename detail::MultiplyScales<Lhs, Rhs>::Type;
+
+  MultiplyScales() = delete;
+
+  MultiplyScales(const MultiplyScales&) = delete;
+
+  MultiplyScales(MultiplyScales&&) = delete;
+
+  ~MultiplyScales() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Statically computes the quotient of two scales. The result is a std::ratio whenever it
+///         is representable as one and a @class FactoredScale otherwise.
+/// @tparam Lhs_    std::ratio or FactoredScale.
+/// @tparam Rhs_    std::ratio or FactoredScale.
+
+template<typename Lhs_, typename Rhs_>
+class DivideScales
+{
+public:
+  using Lhs = Lhs_;
+  using Rhs = Rhs_;
+  using SelfType = DivideScales<Lhs, Rhs>;
+
+  /// Scale resulting from the division of LHS by RHS.
+  using Result =
+      typename detail::MultiplyScales<Lhs, typename detail::Reciprocal<Rhs>::Type>::Type;
+
+  DivideScales() = delete;
+
+  DivideScales(const DivideScales&) = delete;
+
+  DivideScales(DivideScales&&) = delete;
+
+  ~DivideScales() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+/// @brief  Statically evaluates a scale as a floating point number.
+///
+///         For a std::ratio the value is FloatType(num) / FloatType(den). For a
+///         @class FactoredScale the numerator and denominator are accumulated and divided in
+///         long double, and only the quotient is rounded to FloatType, so that the value is as
+///         close to exact as the representation permits even where a term alone would overflow
+///         or underflow it.
+///
+/// @tparam Scale_      std::ratio or FactoredScale.
+/// @tparam FloatType_  Floating point representation of the value.
+
+template<typename Scale_, typename FloatType_>
+class ScaleValue
+{
+public:
+  using Scale = Scale_;
+  using FloatType = FloatType_;
+  using SelfType = ScaleValue<Scale, FloatType>;
+
+  static constexpr const FloatType kValue{ FloatType(Scale::num) / FloatType(Scale::den) };
+
+  ScaleValue() = delete;
+
+  ScaleValue(const ScaleValue&) = delete;
+
+  ScaleValue(ScaleValue&&) = delete;
+
+  ~ScaleValue() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+template<typename... PrimePowers_, typename FloatType_>
+class ScaleValue<FactoredScale<PrimePowers_...>, FloatType_>
+{
+public:
+  using Scale = FactoredScale<PrimePowers_...>;
+  using FloatType = FloatType_;
+  using SelfType = ScaleValue<Scale, FloatType>;
+
+  static constexpr const FloatType kValue{ FloatType(
+      detail::floatProduct(detail::power(
+          static_cast<long double>(PrimePowers_::kPrime),
+          PrimePowers_::kExponent)...) /
+      detail::floatProduct(detail::power(
+          static_cast<long double>(PrimePowers_::kPrime),
+          -PrimePowers_::kExponent)...)) };
+
+  ScaleValue() = delete;
+
+  ScaleValue(const ScaleValue&) = delete;
+
+  ScaleValue(ScaleValue&&) = delete;
+
+  ~ScaleValue() = delete;
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+};
+
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,509 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#if not(defined(__unix__) or defined(__APPLE__))
+#error "units/sharedRing.hpp requires POSIX shared memory."
+#endif
+
+#include "affineQuantity.hpp"
+#include "span.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+
+/// Single-producer / multi-consumer ring buffer of affine quantities in POSIX shared memory. The
+/// segment starts with a descriptor of the channel (dimension exponents, scale and representation)
+/// against which a consumer is validated once when it attaches; reads thereafter are typed spans
+/// straight into the shared segment.
+///
+/// Every attached consumer sees every sample. The producer never overwrites a sample that an
+/// attached consumer has not released yet: write() stores as many samples as fit and returns that
+/// count. A consumer that terminates without detaching keeps holding its slot and stalls the
+/// producer once the ring fills; recreate the channel in that case.
+///
+/// shm_open lives in librt on glibc older than 2.34; link against it there.
+
+namespace units
+{
+
+namespace detail
+{
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared ring buffers require lock-free 64-bit atomics.");
+
+/// Layout-stable description of the affine quantity carried by a channel.
+struct ChannelDescriptor
+{
+  std::int64_t mExponentNumerators[7];
+  std::int64_t mExponentDenominators[7];
+  std::int64_t mScaleNumerator;
+  std::int64_t mScaleDenominator;
+  std::uint32_t mRepresentationKind;
+  std::uint32_t mRepresentationSize;
+};
+
+template<typename FloatType>
+constexpr std::uint32_t representationKind()
+{
+  return std::is_floating_point<FloatType>::value ? 'f'
+         : std::is_signed<FloatType>::value       ? 'i'
+                                                  : 'u';
+}
+
+template<typename Quantity>
+ChannelDescriptor describeChannel()
+{
+  using PhysicalUnits = typename Quantity::PhysicalUnits;
+  using Dimensions = typename PhysicalUnits::PhysicalDimensions;
+  using Scale = typename PhysicalUnits::Scale;
+  using FloatType = typename Quantity::FloatType;
+
+  static_assert(
+      IsRatio<Scale>::value,
+      "Shared ring buffers carry std::ratio scales only; this scale overflows std::intmax_t.");
+
+  static_assert(
+      std::is_arithmetic<FloatType>::value,
+      "Shared ring buffers carry quantities with scalar arithmetic representations only.");
+
+  return ChannelDescriptor{
+    { Dimensions::L::num,
+      Dimensions::M::num,
+      Dimensions::T::num,
+      Dimensions::I::num,
+      Dimensions::K::num,
+      Dimensions::N::num,
+      Dimensions::J::num },
+    { Dimensions::L::den,
+      Dimensions::M::den,
+      Dimensions::T::den,
+      Dimensions::I::den,
+      Dimensions::K::den,
+      Dimensions::N::den,
+      Dimensions::J::den },
+    Scale::num,
+    Scale::den,
+    representationKind<FloatType>(),
+    sizeof(FloatType)
+  };
+}
+
+inline bool operator==(const ChannelDescriptor& lhs, const ChannelDescriptor& rhs)
+{
+  return std::memcmp(&lhs, &rhs, sizeof(ChannelDescriptor)) == 0;
+}
+
+/// Maximum number of consumers attached to a channel at once.
+constexpr std::size_t kSharedRingMaxConsumers = 8;
+
+/// 'unitsRNG' followed by the layout version.
+constexpr std::uint64_t kSharedRingMagic = 0x756e697473524e47ULL;
+constexpr std::uint32_t kSharedRingVersion = 1;
+
+/// States of a consumer slot. A slot is claimed as attaching, given a tail and only then marked
+/// attached, so that the producer never sees the tail of an earlier consumer of the slot.
+constexpr std::uint32_t kCursorDetached = 0;
+constexpr std::uint32_t kCursorAttached = 1;
+constexpr std::uint32_t kCursorAttaching = 2;
+
+struct alignas(64) SharedRingCursor
+{
+  std::atomic<std::uint32_t> mAttached;
+  std::atomic<std::uint64_t> mTail;
+};
+
+/// Header at the start of the shared segment. The samples follow it.
+struct alignas(64) SharedRingHeader
+{
+  std::atomic<std::uint64_t> mMagic;
+  std::uint32_t mVersion;
+  std::uint32_t mReserved;
+  std::uint64_t mCapacity;
+  ChannelDescriptor mDescriptor;
+  alignas(64) std::atomic<std::uint64_t> mHead;
+  SharedRingCursor mCursors[kSharedRingMaxConsumers];
+};
+
+[[noreturn]] inline void throwSystemError(const char* const what, const std::string& name)
+{
+  throw std::runtime_error(
+      std::string(what) + " '" + name + "': " + std::strerror(errno));
+}
+
+/// Owns the mapping of a shared ring segment.
+class SharedRingMapping
+{
+public:
+  using SelfType = SharedRingMapping;
+
+  SharedRingMapping() noexcept(true): mAddress(nullptr), mBytes(0) {}
+
+  SharedRingMapping(void* const address, const std::size_t bytes) noexcept(true):
+      mAddress(address),
+      mBytes(bytes)
+  {
+  }
+
+  SharedRingMapping(const SharedRingMapping&) = delete;
+
+  SharedRingMapping(SharedRingMapping&& rhs) noexcept(true):
+      mAddress(rhs.mAddress),
+      mBytes(rhs.mBytes)
+  {
+    rhs.mAddress = nullptr;
+    rhs.mBytes = 0;
+  }
+
+  ~SharedRingMapping()
+  {
+    if(mAddress != nullptr)
+    {
+      ::munmap(mAddress, mBytes);
+    }
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&& rhs) noexcept(true)
+  {
+    std::swap(mAddress, rhs.mAddress);
+    std::swap(mBytes, rhs.mBytes);
+    return *this;
+  }
+
+  SharedRingHeader* header() const noexcept(true)
+  {
+    return static_cast<SharedRingHeader*>(mAddress);
+  }
+
+  void* samples() const noexcept(true)
+  {
+    return static_cast<char*>(mAddress) + sizeof(SharedRingHeader);
+  }
+
+private:
+  void* mAddress;
+  std::size_t mBytes;
+};
+
+inline SharedRingMapping
+mapSharedRing(const int descriptor, const std::size_t bytes, const std::string& name)
+{
+  void* const address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  ::close(descriptor);
+
+  if(address == MAP_FAILED)
+  {
+    throwSystemError("Failed to map shared ring", name);
+  }
+
+  return SharedRingMapping(address, bytes);
+}
+
+} // End of namespace detail.
+
+/// @brief  Producer end of a shared ring buffer of @tparam Quantity. Creates the shared memory
+///         object on construction and unlinks it on destruction; consumers that are still attached
+///         keep their mapping until they detach.
+///
+///         EG: SharedRingProducer<Metres> ranges("/lidarRanges", 1U << 16U);
+///             ranges.write(samples, count);
+///
+/// @tparam Quantity    An affine quantity with a std::ratio scale and an arithmetic representation.
+template<typename Quantity>
+class SharedRingProducer
+{
+public:
+  using SelfType = SharedRingProducer<Quantity>;
+
+  static_assert(
+      std::is_trivially_copyable<Quantity>::value and
+          sizeof(Quantity) == sizeof(typename Quantity::FloatType),
+      "Shared ring buffers require quantities laid out as their representation.");
+
+  /// @brief  Creates the shared memory object @param name holding up to @param capacity samples.
+  ///         Throws std::runtime_error if the object already exists or cannot be created.
+  /// @param  name        POSIX shared memory name i.e. "/" followed by up to NAME_MAX characters.
+  /// @param  capacity    Number of samples; rounded up to a power of two.
+  SharedRingProducer(std::string name, const std::size_t capacity):
+      mName(std::move(name)),
+      mCapacity(roundUpToPowerOfTwo(capacity))
+  {
+    const int descriptor = ::shm_open(mName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if(descriptor < 0)
+    {
+      detail::throwSystemError("Failed to create shared ring", mName);
+    }
+
+    const std::size_t bytes = sizeof(detail::SharedRingHeader) + mCapacity * sizeof(Quantity);
+
+    if(::ftruncate(descriptor, static_cast<off_t>(bytes)) != 0)
+    {
+      ::close(descriptor);
+      ::shm_unlink(mName.c_str());
+      detail::throwSystemError("Failed to size shared ring", mName);
+    }
+
+    try
+    {
+      mMapping = detail::mapSharedRing(descriptor, bytes, mName);
+    }
+    catch(...)
+    {
+      ::shm_unlink(mName.c_str());
+      throw;
+    }
+
+    detail::SharedRingHeader* const header = new(mMapping.header()) detail::SharedRingHeader{};
+    header->mVersion = detail::kSharedRingVersion;
+    header->mCapacity = mCapacity;
+    header->mDescriptor = detail::describeChannel<Quantity>();
+
+    // Publishing the magic number last lets consumers tell a fully initialised header apart.
+    header->mMagic.store(detail::kSharedRingMagic, std::memory_order_release);
+  }
+
+  SharedRingProducer(const SharedRingProducer&) = delete;
+
+  SharedRingProducer(SharedRingProducer&&) = delete;
+
+  ~SharedRingProducer()
+  {
+    ::shm_unlink(mName.c_str());
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+  /// @brief  Capacity of the ring in samples.
+  /// @return
+  std::size_t capacity() const noexcept(true)
+  {
+    return mCapacity;
+  }
+
+  /// @brief  Appends up to @param size samples from @param input, limited by the space released
+  ///         by the slowest attached consumer.
+  /// @param  input
+  /// @param  size
+  /// @return Number of samples written.
+  std::size_t write(const Quantity* const input, const std::size_t size) noexcept(true)
+  {
+    detail::SharedRingHeader* const header = mMapping.header();
+    const std::uint64_t head = header->mHead.load(std::memory_order_relaxed);
+    std::uint64_t tail = head;
+
+    for(auto& cursor: header->mCursors)
+    {
+      if(cursor.mAttached.load(std::memory_order_seq_cst) == detail::kCursorAttached)
+      {
+        const std::uint64_t consumerTail = cursor.mTail.load(std::memory_order_acquire);
+        tail = consumerTail < tail ? consumerTail : tail;
+      }
+    }
+
+    // A tail read while its consumer attaches or detaches may lag the head by more than the
+    // capacity. Clamping makes the ring look full for this call instead of underflowing.
+    const std::uint64_t used = head - tail < mCapacity ? head - tail : mCapacity;
+    const std::size_t available = mCapacity - static_cast<std::size_t>(used);
+    const std::size_t count = size < available ? size : available;
+    Quantity* const samples = static_cast<Quantity*>(mMapping.samples());
+    const std::size_t offset = static_cast<std::size_t>(head) & (mCapacity - 1U);
+    const std::size_t first = count < mCapacity - offset ? count : mCapacity - offset;
+
+    std::memcpy(static_cast<void*>(samples + offset), input, first * sizeof(Quantity));
+    std::memcpy(static_cast<void*>(samples), input + first, (count - first) * sizeof(Quantity));
+
+    header->mHead.store(head + count, std::memory_order_seq_cst);
+    return count;
+  }
+
+private:
+  static std::size_t roundUpToPowerOfTwo(const std::size_t value) noexcept(true)
+  {
+    std::size_t result = 1;
+
+    while(result < value)
+    {
+      result <<= 1U;
+    }
+
+    return result;
+  }
+
+  std::string mName;
+  std::size_t mCapacity;
+  detail::SharedRingMapping mMapping;
+};
+
+/// @brief  Consumer end of a shared ring buffer of @tparam Quantity. Attaching validates the
+///         channel against @tparam Quantity once; peek() thereafter hands out spans into the
+///         shared segment without copying or converting.
+///
+///         EG: SharedRingConsumer<Metres> ranges("/lidarRanges");
+///             const auto span = ranges.peek();
+///             process(span.data(), span.size());
+///             ranges.release(span.size());
+///
+/// @tparam Quantity    Must match the quantity of the producer exactly: same dimensions, same
+///                     scale and same representation. The conversion policy is not recorded.
+template<typename Quantity>
+class SharedRingConsumer
+{
+public:
+  using SelfType = SharedRingConsumer<Quantity>;
+
+  static_assert(
+      std::is_trivially_copyable<Quantity>::value and
+          sizeof(Quantity) == sizeof(typename Quantity::FloatType),
+      "Shared ring buffers require quantities laid out as their representation.");
+
+  /// @brief  Attaches to the shared ring @param name, starting at the producer's current head.
+  ///         Throws std::runtime_error if the ring does not exist, carries a different quantity
+  ///         or already has the maximum number of consumers attached.
+  /// @param  name
+  explicit SharedRingConsumer(const std::string& name)
+  {
+    const int descriptor = ::shm_open(name.c_str(), O_RDWR, 0600);
+
+    if(descriptor < 0)
+    {
+      detail::throwSystemError("Failed to open shared ring", name);
+    }
+
+    struct stat status
+    {
+    };
+
+    if(::fstat(descriptor, &status) != 0 or
+       static_cast<std::size_t>(status.st_size) < sizeof(detail::SharedRingHeader))
+    {
+      ::close(descriptor);
+      throw std::runtime_error("Shared ring '" + name + "' is not initialised.");
+    }
+
+    mMapping = detail::mapSharedRing(descriptor, static_cast<std::size_t>(status.st_size), name);
+    detail::SharedRingHeader* const header = mMapping.header();
+
+    if(header->mMagic.load(std::memory_order_acquire) != detail::kSharedRingMagic or
+       header->mVersion != detail::kSharedRingVersion)
+    {
+      throw std::runtime_error("Shared ring '" + name + "' is not initialised.");
+    }
+
+    if(not(header->mDescriptor == detail::describeChannel<Quantity>()))
+    {
+      throw std::runtime_error(
+          "Shared ring '" + name + "' carries a different quantity than the one requested.");
+    }
+
+    mCapacity = static_cast<std::size_t>(header->mCapacity);
+
+    for(auto& cursor: header->mCursors)
+    {
+      std::uint32_t detached = detail::kCursorDetached;
+
+      if(cursor.mAttached.compare_exchange_strong(
+             detached, detail::kCursorAttaching, std::memory_order_acq_rel))
+      {
+        mCursor = &cursor;
+        break;
+      }
+    }
+
+    if(mCursor == nullptr)
+    {
+      throw std::runtime_error("Shared ring '" + name + "' has no free consumer slot.");
+    }
+
+    // The tail is published before the slot counts as attached. Writes that started before the
+    // producer could see the slot ignore it, so the head is read again once the slot is attached;
+    // at most the write in flight at that point started below the second head.
+    mCursor->mTail.store(header->mHead.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    mCursor->mAttached.store(detail::kCursorAttached, std::memory_order_seq_cst);
+    mTail = header->mHead.load(std::memory_order_seq_cst);
+    mCursor->mTail.store(mTail, std::memory_order_seq_cst);
+  }
+
+  SharedRingConsumer(const SharedRingConsumer&) = delete;
+
+  SharedRingConsumer(SharedRingConsumer&&) = delete;
+
+  ~SharedRingConsumer()
+  {
+    mCursor->mAttached.store(detail::kCursorAttaching, std::memory_order_seq_cst);
+    mCursor->mTail.store(0U, std::memory_order_relaxed);
+    mCursor->mAttached.store(detail::kCursorDetached, std::memory_order_release);
+  }
+
+  SelfType& operator=(const SelfType&) = delete;
+
+  SelfType& operator=(SelfType&&) = delete;
+
+  /// @brief  Samples published by the producer and not released yet by this consumer, up to the
+  ///         end of the ring. Once released, the samples that wrap around to the start of the ring
+  ///         are returned by the next call.
+  /// @return
+  QuantitySpan<const Quantity> peek() const noexcept(true)
+  {
+    const std::uint64_t head = mMapping.header()->mHead.load(std::memory_order_acquire);
+    const std::size_t offset = static_cast<std::size_t>(mTail) & (mCapacity - 1U);
+    const std::size_t pending = static_cast<std::size_t>(head - mTail);
+    const std::size_t count = pending < mCapacity - offset ? pending : mCapacity - offset;
+
+    return QuantitySpan<const Quantity>(
+        static_cast<const Quantity*>(mMapping.samples()) + offset, count);
+  }
+
+  /// @brief  Hands the oldest @param count samples back to the producer. Spans obtained from
+  ///         peek() must not be accessed past the samples released.
+  /// @param  count   At most the size of the last span returned by peek().
+  void release(const std::size_t count) noexcept(true)
+  {
+    mTail += count;
+    mCursor->mTail.store(mTail, std::memory_order_release);
+  }
+
+private:
+  detail::SharedRingMapping mMapping;
+  detail::SharedRingCursor* mCursor = nullptr;
+  std::size_t mCapacity = 0;
+  std::uint64_t mTail = 0;
+};
+
+} // End of namespace units.
\ No newline at end of file
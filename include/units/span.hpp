@@ -0,0 +1,82 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+
+namespace units
+{
+
+/// @brief  Contiguous view of quantities. Minimal stand-in for std::span, which is C++20.
+/// @tparam Quantity
+template<typename Quantity>
+class QuantitySpan
+{
+public:
+  using SelfType = QuantitySpan<Quantity>;
+
+  constexpr QuantitySpan() noexcept(true): mData(nullptr), mSize(0) {}
+
+  constexpr QuantitySpan(Quantity* const data, const std::size_t size) noexcept(true):
+      mData(data),
+      mSize(size)
+  {
+  }
+
+  constexpr Quantity* data() const noexcept(true)
+  {
+    return mData;
+  }
+
+  constexpr std::size_t size() const noexcept(true)
+  {
+    return mSize;
+  }
+
+  constexpr bool empty() const noexcept(true)
+  {
+    return mSize == 0;
+  }
+
+  constexpr Quantity* begin() const noexcept(true)
+  {
+    return mData;
+  }
+
+  constexpr Quantity* end() const noexcept(true)
+  {
+    return mData + mSize;
+  }
+
+  constexpr Quantity& operator[](const std::size_t index) const noexcept(true)
+  {
+    return mData[index];
+  }
+
+private:
+  Quantity* mData;
+  std::size_t mSize;
+};
+
+} // End of namespace units.
\ No newline at end of file
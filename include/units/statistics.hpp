@@ -0,0 +1,897 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include "affineQuantity.hpp"
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/// Streaming accumulators over affine quantities with O(1) work per sample: exponentially weighted
+/// mean and variance, rolling mean and variance over a fixed window and rolling minimum / maximum.
+/// The multi-channel variants keep N channels in structure-of-arrays form and update all of them
+/// from one sample per channel with AVX2 where available.
+///
+/// Variances are typed in the square of the units of the samples, standard deviations in the units
+/// of the samples.
+
+namespace units
+{
+
+/// Affine quantity holding the variance of samples of @tparam Quantity.
+///
+/// EG: VarianceQuantity<Metres> is expressed in metre².
+template<typename Quantity>
+using VarianceQuantity = AffineQuantity<
+    typename MultiplyPhysicalUnits<
+        typename Quantity::PhysicalUnits,
+        typename Quantity::PhysicalUnits,
+        PreserveScalePolicy>::Result,
+    typename Quantity::FloatType,
+    typename Quantity::ConversionPolicy>;
+
+namespace detail
+{
+
+template<typename Quantity>
+struct StatisticsCompatible
+{
+  static constexpr bool value =
+      std::is_floating_point<typename Quantity::FloatType>::value and
+      sizeof(Quantity) == sizeof(typename Quantity::FloatType);
+};
+
+/// Exponentially weighted update: mean += alpha * delta; variance = (1 - alpha) * (variance +
+/// alpha * delta²).
+template<typename FloatType>
+inline void scalarEwmaKernel(
+    FloatType* const mean,
+    FloatType* const variance,
+    const FloatType* const samples,
+    const std::size_t size,
+    const FloatType smoothing) noexcept(true)
+{
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    const FloatType delta = samples[index] - mean[index];
+    const FloatType increment = smoothing * delta;
+    mean[index] += increment;
+    variance[index] = (FloatType(1) - smoothing) * (variance[index] + delta * increment);
+  }
+}
+
+/// Welford update while the window fills up: @param inverseCount is 1 / (samples so far).
+template<typename FloatType>
+inline void scalarRollingAddKernel(
+    FloatType* const mean,
+    FloatType* const squares,
+    const FloatType* const samples,
+    const std::size_t size,
+    const FloatType inverseCount) noexcept(true)
+{
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    const FloatType delta = samples[index] - mean[index];
+    mean[index] += delta * inverseCount;
+    squares[index] += delta * (samples[index] - mean[index]);
+  }
+}
+
+/// Welford update of a full window in which @param oldest is replaced by @param samples.
+template<typename FloatType>
+inline void scalarRollingReplaceKernel(
+    FloatType* const mean,
+    FloatType* const squares,
+    const FloatType* const samples,
+    const FloatType* const oldest,
+    const std::size_t size,
+    const FloatType inverseWindow) noexcept(true)
+{
+  for(std::size_t index = 0; index < size; ++index)
+  {
+    const FloatType delta = samples[index] - oldest[index];
+    const FloatType previousMean = mean[index];
+    mean[index] += delta * inverseWindow;
+    squares[index] += delta * ((samples[index] - mean[index]) + (oldest[index] - previousMean));
+  }
+}
+
+template<typename FloatType>
+inline void ewmaKernel(
+    FloatType* const mean,
+    FloatType* const variance,
+    const FloatType* const samples,
+    const std::size_t size,
+    const FloatType smoothing) noexcept(true)
+{
+  scalarEwmaKernel(mean, variance, samples, size, smoothing);
+}
+
+template<typename FloatType>
+inline void rollingAddKernel(
+    FloatType* const mean,
+    FloatType* const squares,
+    const FloatType* const samples,
+    const std::size_t size,
+    const FloatType inverseCount) noexcept(true)
+{
+  scalarRollingAddKernel(mean, squares, samples, size, inverseCount);
+}
+
+template<typename FloatType>
+inline void rollingReplaceKernel(
+    FloatType* const mean,
+    FloatType* const squares,
+    const FloatType* const samples,
+    const FloatType* const oldest,
+    const std::size_t size,
+    const FloatType inverseWindow) noexcept(true)
+{
+  scalarRollingReplaceKernel(mean, squares, samples, oldest, size, inverseWindow);
+}
+
+#if defined(__AVX2__)
+
+inline __m256d avxLoad(const double* const input) noexcept(true)
+{
+  return _mm256_loadu_pd(input);
+}
+
+inline __m256 avxLoad(const float* const input) noexcept(true)
+{
+  return _mm256_loadu_ps(input);
+}
+
+inline void avxStore(double* const output, const __m256d value) noexcept(true)
+{
+  _mm256_storeu_pd(output, value);
+}
+
+inline void avxStore(float* const output, const __m256 value) noexcept(true)
+{
+  _mm256_storeu_ps(output, value);
+}
+
+inline __m256d avxBroadcast(const double value) noexcept(true)
+{
+  return _mm256_set1_pd(value);
+}
+
+inline __m256 avxBroadcast(const float value) noexcept(true)
+{
+  return _mm256_set1_ps(value);
+}
+
+inline __m256d avxAdd(const __m256d lhs, const __m256d rhs) noexcept(true)
+{
+  return _mm256_add_pd(lhs, rhs);
+}
+
+inline __m256 avxAdd(const __m256 lhs, const __m256 rhs) noexcept(true)
+{
+  return _mm256_add_ps(lhs, rhs);
+}
+
+inline __m256d avxSubtract(const __m256d lhs, const __m256d rhs) noexcept(true)
+{
+  return _mm256_sub_pd(lhs, rhs);
+}
+
+inline __m256 avxSubtract(const __m256 lhs, const __m256 rhs) noexcept(true)
+{
+  return _mm256_sub_ps(lhs, rhs);
+}
+
+inline __m256d avxMultiply(const __m256d lhs, const __m256d rhs) noexcept(true)
+{
+  return _mm256_mul_pd(lhs, rhs);
+}
+
+inline __m256 avxMultiply(const __m256 lhs, const __m256 rhs) noexcept(true)
+{
+  return _mm256_mul_ps(lhs, rhs);
+}
+
+template<typename FloatType>
+inline void avxEwmaKernel(
+    FloatType* const mean,
+    FloatType* const variance,
+    const FloatType* const samples,
+    const std::size_t size,
+    const FloatType smoothing) noexcept(true)
+{
+  constexpr std::size_t kLanes = 32U / sizeof(FloatType);
+  const auto alpha = avxBroadcast(smoothing);
+  const auto complement = avxBroadcast(FloatType(1) - smoothing);
+
+  std::size_t index = 0;
+  for(; index + kLanes <= size; index += kLanes)
+  {
+    const auto average = avxLoad(mean + index);
+    const auto delta = avxSubtract(avxLoad(samples + index), average);
+    const auto increment = avxMultiply(alpha, delta);
+    avxStore(mean + index, avxAdd(average, increment));
+    avxStore(
+        variance + index,
+        avxMultiply(complement, avxAdd(avxLoad(variance + index), avxMultiply(delta, increment))));
+  }
+
+  scalarEwmaKernel(mean + index, variance + index, samples + index, size - index, smoothing);
+}
+
+template<typename FloatType>
+inline void avxRollingAddKernel(
+    FloatType* const mean,
+    FloatType* const squares,
+    const FloatType* const samples,
+    const std::size_t size,
+    const FloatType inverseCount) noexcept(true)
+{
+  constexpr std::size_t kLanes = 32U / sizeof(FloatType);
+  const auto scale = avxBroadcast(inverseCount);
+
+  std::size_t index = 0;
+  for(; index + kLanes <= size; index += kLanes)
+  {
+    const auto sample = avxLoad(samples + index);
+    const auto previousMean = avxLoad(mean + index);
+    const auto delta = avxSubtract(sample, previousMean);
+    const auto average = avxAdd(previousMean, avxMultiply(delta, scale));
+    avxStore(mean + index, average);
+    avxStore(
+        squares + index,
+        avxAdd(avxLoad(squares + index), avxMultiply(delta, avxSubtract(sample, average))));
+  }
+
+  scalarRollingAddKernel(
+      mean + index, squares + index, samples + index, size - index, inverseCount);
+}
+
+template<typename FloatType>
+inline void avxRollingReplaceKernel(
+    FloatType* const mean,
+    FloatType* const squares,
+    const FloatType* const samples,
+    const FloatType* const oldest,
+    const std::size_t size,
+    const FloatType inverseWindow) noexcept(true)
+{
+  constexpr std::size_t kLanes = 32U / sizeof(FloatType);
+  const auto scale = avxBroadcast(inverseWindow);
+
+  std::size_t index = 0;
+  for(; index + kLanes <= size; index += kLanes)
+  {
+    const auto sample = avxLoad(samples + index);
+    const auto old = avxLoad(oldest + index);
+    const auto previousMean = avxLoad(mean + index);
+    const auto delta = avxSubtract(sample, old);
+    const auto average = avxAdd(previousMean, avxMultiply(delta, scale));
+    const auto spread = avxAdd(avxSubtract(sample, average), avxSubtract(old, previousMean));
+    avxStore(mean + index, average);
+    avxStore(squares + index, avxAdd(avxLoad(squares + index), avxMultiply(delta, spread)));
+  }
+
+  scalarRollingReplaceKernel(
+      mean + index, squares + index, samples + index, oldest + index, size - index, inverseWindow);
+}
+
+inline void ewmaKernel(
+    double* const mean,
+    double* const variance,
+    const double* const samples,
+    const std::size_t size,
+    const double smoothing) noexcept(true)
+{
+  avxEwmaKernel(mean, variance, samples, size, smoothing);
+}
+
+inline void ewmaKernel(
+    float* const mean,
+    float* const variance,
+    const float* const samples,
+    const std::size_t size,
+    const float smoothing) noexcept(true)
+{
+  avxEwmaKernel(mean, variance, samples, size, smoothing);
+}
+
+inline void rollingAddKernel(
+    double* const mean,
+    double* const squares,
+    const double* const samples,
+    const std::size_t size,
+    const double inverseCount) noexcept(true)
+{
+  avxRollingAddKernel(mean, squares, samples, size, inverseCount);
+}
+
+inline void rollingAddKernel(
+    float* const mean,
+    float* const squares,
+    const float* const samples,
+    const std::size_t size,
+    const float inverseCount) noexcept(true)
+{
+  avxRollingAddKernel(mean, squares, samples, size, inverseCount);
+}
+
+inline void rollingReplaceKernel(
+    double* const mean,
+    double* const squares,
+    const double* const samples,
+    const double* const oldest,
+    const std::size_t size,
+    const double inverseWindow) noexcept(true)
+{
+  avxRollingReplaceKernel(mean, squares, samples, oldest, size, inverseWindow);
+}
+
+inline void rollingReplaceKernel(
+    float* const mean,
+    float* const squares,
+    const float* const samples,
+    const float* const oldest,
+    const std::size_t size,
+    const float inverseWindow) noexcept(true)
+{
+  avxRollingReplaceKernel(mean, squares, samples, oldest, size, inverseWindow);
+}
+
+#endif
+
+struct MinimumComparison
+{
+  template<typename FloatType>
+  static constexpr FloatType select(const FloatType lhs, const FloatType rhs) noexcept(true)
+  {
+    return rhs < lhs ? rhs : lhs;
+  }
+
+  template<typename FloatType>
+  static constexpr FloatType identity() noexcept(true)
+  {
+    return std::numeric_limits<FloatType>::has_infinity ? std::numeric_limits<FloatType>::infinity()
+                                                        : std::numeric_limits<FloatType>::max();
+  }
+};
+
+struct MaximumComparison
+{
+  template<typename FloatType>
+  static constexpr FloatType select(const FloatType lhs, const FloatType rhs) noexcept(true)
+  {
+    return rhs > lhs ? rhs : lhs;
+  }
+
+  template<typename FloatType>
+  static constexpr FloatType identity() noexcept(true)
+  {
+    return std::numeric_limits<FloatType>::has_infinity
+               ? -std::numeric_limits<FloatType>::infinity()
+               : std::numeric_limits<FloatType>::lowest();
+  }
+};
+
+/// @brief  Rolling extremum of the last @tparam Window samples of one channel, kept in a
+///         monotonic deque stored in a fixed ring. Every sample is pushed and popped at most once,
+///         so an update costs O(1) amortised.
+template<typename Quantity, std::size_t Window, typename Comparison>
+class RollingExtremum
+{
+public:
+  using SelfType = RollingExtremum<Quantity, Window, Comparison>;
+  using FloatType = typename Quantity::FloatType;
+
+  static_assert(Window > 0U, "Rolling windows must hold at least one sample.");
+
+  /// @brief  Adds @param sample to the window, evicting the oldest one once the window is full.
+  /// @param  sample
+  void update(const Quantity sample) noexcept(true)
+  {
+    const FloatType value = sample.scalar();
+
+    // Evict the front once it slides out of the window.
+    if(mSize > 0U and mIndices[mFront] + Window <= mCount)
+    {
+      mFront = (mFront + 1U) % Window;
+      --mSize;
+    }
+
+    // Drop the entries that can no longer become the extremum: those the new sample matches.
+    while(mSize > 0U and Comparison::select(mValues[back()], value) == value)
+    {
+      --mSize;
+    }
+
+    const std::size_t slot = (mFront + mSize) % Window;
+    mValues[slot] = value;
+    mIndices[slot] = mCount;
+    ++mSize;
+    ++mCount;
+  }
+
+  /// @brief  Number of samples added so far.
+  /// @return
+  std::size_t count() const noexcept(true)
+  {
+    return mCount;
+  }
+
+  /// @brief  Extremum of the window. Requires at least one sample.
+  /// @return
+  Quantity value() const noexcept(true)
+  {
+    return Quantity(mValues[mFront]);
+  }
+
+private:
+  std::size_t back() const noexcept(true)
+  {
+    return (mFront + mSize - 1U) % Window;
+  }
+
+  FloatType mValues[Window]{};
+  std::size_t mIndices[Window]{};
+  std::size_t mFront = 0;
+  std::size_t mSize = 0;
+  std::size_t mCount = 0;
+};
+
+/// @brief  Rolling extremum of the last @tparam Window samples of @tparam Channels channels with
+///         the van Herk / Gil-Werman scheme: samples are grouped in blocks of Window, a running
+///         extremum of the current block is combined with the suffix extrema of the previous one.
+///         The suffix extrema are recomputed once per block, so an update costs O(1) amortised and
+///         every step is a branch-free loop across channels.
+template<typename Quantity, std::size_t Channels, std::size_t Window, typename Comparison>
+class MultiChannelRollingExtremum
+{
+public:
+  using SelfType = MultiChannelRollingExtremum<Quantity, Channels, Window, Comparison>;
+  using FloatType = typename Quantity::FloatType;
+
+  static_assert(Window > 0U, "Rolling windows must hold at least one sample.");
+
+  MultiChannelRollingExtremum() noexcept(true)
+  {
+    for(std::size_t index = 0; index < Window * Channels; ++index)
+    {
+      mSuffix[index] = Comparison::template identity<FloatType>();
+    }
+  }
+
+  /// @brief  Adds one sample per channel from @param samples.
+  /// @param  samples     @tparam Channels samples.
+  void update(const Quantity* const samples) noexcept(true)
+  {
+    const FloatType* const input = reinterpret_cast<const FloatType*>(samples);
+    FloatType* const block = mBlock + mPosition * Channels;
+
+    for(std::size_t channel = 0; channel < Channels; ++channel)
+    {
+      block[channel] = input[channel];
+      mPrefix[channel] =
+          mPosition == 0U ? input[channel] : Comparison::select(mPrefix[channel], input[channel]);
+    }
+
+    if(mPosition + 1U == Window)
+    {
+      // The block is complete: its suffix extrema serve the windows ending in the next block.
+      for(std::size_t channel = 0; channel < Channels; ++channel)
+      {
+        mSuffix[(Window - 1U) * Channels + channel] = mBlock[(Window - 1U) * Channels + channel];
+      }
+
+      for(std::size_t position = Window - 1U; position-- > 0U;)
+      {
+        for(std::size_t channel = 0; channel < Channels; ++channel)
+        {
+          mSuffix[position * Channels + channel] = Comparison::select(
+              mSuffix[(position + 1U) * Channels + channel], mBlock[position * Channels + channel]);
+        }
+      }
+
+      for(std::size_t channel = 0; channel < Channels; ++channel)
+      {
+        mExtremum[channel] = mPrefix[channel];
+      }
+
+      mPosition = 0;
+      return;
+    }
+
+    const FloatType* const suffix = mSuffix + (mPosition + 1U) * Channels;
+
+    for(std::size_t channel = 0; channel < Channels; ++channel)
+    {
+      mExtremum[channel] = Comparison::select(suffix[channel], mPrefix[channel]);
+    }
+
+    ++mPosition;
+  }
+
+  /// @brief  Extremum of the window of @param channel. Requires at least one sample.
+  /// @param  channel
+  /// @return
+  Quantity value(const std::size_t channel) const noexcept(true)
+  {
+    return Quantity(mExtremum[channel]);
+  }
+
+private:
+  FloatType mBlock[Window * Channels]{};
+  FloatType mSuffix[Window * Channels]{};
+  FloatType mPrefix[Channels]{};
+  FloatType mExtremum[Channels]{};
+  std::size_t mPosition = 0;
+};
+
+} // End of namespace detail.
+
+/// @brief  Exponentially weighted moving average and variance of a stream of @tparam Quantity.
+///         The first sample initialises the mean.
+///
+///         EG: ExponentialMovingAverage<Metres> altitude(0.1);
+///             altitude.update(Metres(12.0));
+///             altitude.standardDeviation();
+///
+/// @tparam Quantity    Affine quantity with a floating point representation.
+template<typename Quantity>
+class ExponentialMovingAverage
+{
+public:
+  using SelfType = ExponentialMovingAverage<Quantity>;
+  using FloatType = typename Quantity::FloatType;
+  using Variance = VarianceQuantity<Quantity>;
+
+  static_assert(
+      detail::StatisticsCompatible<Quantity>::value,
+      "Statistics require quantities with a floating point representation.");
+
+  /// @brief  Construction with the weight @param smoothing in (0, 1] of each new sample.
+  /// @param  smoothing
+  explicit ExponentialMovingAverage(const FloatType smoothing) noexcept(true):
+      mSmoothing(smoothing)
+  {
+  }
+
+  /// @brief  Adds @param sample.
+  /// @param  sample
+  void update(const Quantity sample) noexcept(true)
+  {
+    const FloatType value = sample.scalar();
+
+    if(mCount++ == 0U)
+    {
+      mMean = value;
+      return;
+    }
+
+    detail::ewmaKernel(&mMean, &mVariance, &value, 1U, mSmoothing);
+  }
+
+  /// @brief  Number of samples added so far.
+  /// @return
+  std::size_t count() const noexcept(true)
+  {
+    return mCount;
+  }
+
+  /// @brief  Weighted mean.
+  /// @return
+  Quantity mean() const noexcept(true)
+  {
+    return Quantity(mMean);
+  }
+
+  /// @brief  Weighted variance.
+  /// @return
+  Variance variance() const noexcept(true)
+  {
+    return Variance(mVariance);
+  }
+
+  /// @brief  Weighted standard deviation.
+  /// @return
+  Quantity standardDeviation() const noexcept(true)
+  {
+    return Quantity(std::sqrt(mVariance));
+  }
+
+private:
+  FloatType mSmoothing;
+  FloatType mMean = 0;
+  FloatType mVariance = 0;
+  std::size_t mCount = 0;
+};
+
+/// @brief  Mean and sample variance of the last @tparam Window samples of a stream of
+///         @tparam Quantity, updated with Welford's recurrence in O(1) per sample.
+///
+///         EG: RollingStatistics<Seconds, 128> latency;
+///
+/// @tparam Quantity    Affine quantity with a floating point representation.
+/// @tparam Window      Number of samples in the window.
+template<typename Quantity, std::size_t Window>
+class RollingStatistics
+{
+public:
+  using SelfType = RollingStatistics<Quantity, Window>;
+  using FloatType = typename Quantity::FloatType;
+  using Variance = VarianceQuantity<Quantity>;
+
+  static_assert(
+      detail::StatisticsCompatible<Quantity>::value,
+      "Statistics require quantities with a floating point representation.");
+
+  static_assert(Window > 0U, "Rolling windows must hold at least one sample.");
+
+  /// @brief  Adds @param sample to the window, evicting the oldest one once the window is full.
+  /// @param  sample
+  void update(const Quantity sample) noexcept(true)
+  {
+    const FloatType value = sample.scalar();
+    FloatType& slot = mHistory[mCount % Window];
+
+    if(mCount < Window)
+    {
+      detail::rollingAddKernel(
+          &mMean, &mSquares, &value, 1U, FloatType(1) / FloatType(mCount + 1U));
+    }
+    else
+    {
+      detail::rollingReplaceKernel(&mMean, &mSquares, &value, &slot, 1U, FloatType(1) / Window);
+    }
+
+    slot = value;
+    ++mCount;
+  }
+
+  /// @brief  Number of samples in the window.
+  /// @return
+  std::size_t size() const noexcept(true)
+  {
+    return mCount < Window ? mCount : Window;
+  }
+
+  /// @brief  Mean of the window.
+  /// @return
+  Quantity mean() const noexcept(true)
+  {
+    return Quantity(mMean);
+  }
+
+  /// @brief  Sample variance of the window i.e. normalised by size() - 1. Zero for fewer than two
+  ///         samples.
+  /// @return
+  Variance variance() const noexcept(true)
+  {
+    return Variance(
+        size() < 2U or mSquares < FloatType(0) ? FloatType(0)
+                                               : mSquares / FloatType(size() - 1U));
+  }
+
+  /// @brief  Sample standard deviation of the window.
+  /// @return
+  Quantity standardDeviation() const noexcept(true)
+  {
+    return Quantity(std::sqrt(variance().scalar()));
+  }
+
+private:
+  FloatType mHistory[Window]{};
+  FloatType mMean = 0;
+  FloatType mSquares = 0;
+  std::size_t mCount = 0;
+};
+
+/// Rolling minimum of the last @tparam Window samples, kept in a monotonic deque.
+template<typename Quantity, std::size_t Window>
+using RollingMinimum = detail::RollingExtremum<Quantity, Window, detail::MinimumComparison>;
+
+/// Rolling maximum of the last @tparam Window samples, kept in a monotonic deque.
+template<typename Quantity, std::size_t Window>
+using RollingMaximum = detail::RollingExtremum<Quantity, Window, detail::MaximumComparison>;
+
+/// @brief  Exponentially weighted moving averages and variances of @tparam Channels streams of
+///         @tparam Quantity stored as structure of arrays. All channels share the smoothing and
+///         advance together, one sample each per update.
+///
+///         EG: MultiChannelExponentialMovingAverage<Metres, 4096> ranges(0.05);
+///             ranges.update(frame);
+///
+/// @tparam Quantity    Affine quantity with a floating point representation.
+/// @tparam Channels    Number of channels.
+template<typename Quantity, std::size_t Channels>
+class MultiChannelExponentialMovingAverage
+{
+public:
+  using SelfType = MultiChannelExponentialMovingAverage<Quantity, Channels>;
+  using FloatType = typename Quantity::FloatType;
+  using Variance = VarianceQuantity<Quantity>;
+
+  static_assert(
+      detail::StatisticsCompatible<Quantity>::value,
+      "Statistics require quantities with a floating point representation.");
+
+  /// @brief  Construction with the weight @param smoothing in (0, 1] of each new sample.
+  /// @param  smoothing
+  explicit MultiChannelExponentialMovingAverage(const FloatType smoothing) noexcept(true):
+      mSmoothing(smoothing)
+  {
+  }
+
+  /// @brief  Adds one sample per channel from @param samples.
+  /// @param  samples     @tparam Channels samples.
+  void update(const Quantity* const samples) noexcept(true)
+  {
+    const FloatType* const input = reinterpret_cast<const FloatType*>(samples);
+
+    if(mCount++ == 0U)
+    {
+      for(std::size_t channel = 0; channel < Channels; ++channel)
+      {
+        mMean[channel] = input[channel];
+      }
+
+      return;
+    }
+
+    detail::ewmaKernel(mMean, mVariance, input, Channels, mSmoothing);
+  }
+
+  /// @brief  Weighted mean of @param channel.
+  /// @param  channel
+  /// @return
+  Quantity mean(const std::size_t channel) const noexcept(true)
+  {
+    return Quantity(mMean[channel]);
+  }
+
+  /// @brief  Weighted variance of @param channel.
+  /// @param  channel
+  /// @return
+  Variance variance(const std::size_t channel) const noexcept(true)
+  {
+    return Variance(mVariance[channel]);
+  }
+
+  /// @brief  Weighted standard deviation of @param channel.
+  /// @param  channel
+  /// @return
+  Quantity standardDeviation(const std::size_t channel) const noexcept(true)
+  {
+    return Quantity(std::sqrt(mVariance[channel]));
+  }
+
+private:
+  FloatType mMean[Channels]{};
+  FloatType mVariance[Channels]{};
+  FloatType mSmoothing;
+  std::size_t mCount = 0;
+};
+
+/// @brief  Rolling mean and sample variance of the last @tparam Window samples of
+///         @tparam Channels streams of @tparam Quantity stored as structure of arrays.
+///
+/// @tparam Quantity    Affine quantity with a floating point representation.
+/// @tparam Channels    Number of channels.
+/// @tparam Window      Number of samples in the window.
+template<typename Quantity, std::size_t Channels, std::size_t Window>
+class MultiChannelRollingStatistics
+{
+public:
+  using SelfType = MultiChannelRollingStatistics<Quantity, Channels, Window>;
+  using FloatType = typename Quantity::FloatType;
+  using Variance = VarianceQuantity<Quantity>;
+
+  static_assert(
+      detail::StatisticsCompatible<Quantity>::value,
+      "Statistics require quantities with a floating point representation.");
+
+  static_assert(Window > 0U, "Rolling windows must hold at least one sample.");
+
+  /// @brief  Adds one sample per channel from @param samples, evicting the oldest ones once the
+  ///         window is full.
+  /// @param  samples     @tparam Channels samples.
+  void update(const Quantity* const samples) noexcept(true)
+  {
+    const FloatType* const input = reinterpret_cast<const FloatType*>(samples);
+    FloatType* const slot = mHistory + (mCount % Window) * Channels;
+
+    if(mCount < Window)
+    {
+      detail::rollingAddKernel(
+          mMean, mSquares, input, Channels, FloatType(1) / FloatType(mCount + 1U));
+    }
+    else
+    {
+      detail::rollingReplaceKernel(mMean, mSquares, input, slot, Channels, FloatType(1) / Window);
+    }
+
+    for(std::size_t channel = 0; channel < Channels; ++channel)
+    {
+      slot[channel] = input[channel];
+    }
+
+    ++mCount;
+  }
+
+  /// @brief  Number of samples in the window of every channel.
+  /// @return
+  std::size_t size() const noexcept(true)
+  {
+    return mCount < Window ? mCount : Window;
+  }
+
+  /// @brief  Mean of the window of @param channel.
+  /// @param  channel
+  /// @return
+  Quantity mean(const std::size_t channel) const noexcept(true)
+  {
+    return Quantity(mMean[channel]);
+  }
+
+  /// @brief  Sample variance of the window of @param channel.
+  /// @param  channel
+  /// @return
+  Variance variance(const std::size_t channel) const noexcept(true)
+  {
+    return Variance(
+        size() < 2U or mSquares[channel] < FloatType(0)
+            ? FloatType(0)
+            : mSquares[channel] / FloatType(size() - 1U));
+  }
+
+  /// @brief  Sample standard deviation of the window of @param channel.
+  /// @param  channel
+  /// @return
+  Quantity standardDeviation(const std::size_t channel) const noexcept(true)
+  {
+    return Quantity(std::sqrt(variance(channel).scalar()));
+  }
+
+private:
+  FloatType mHistory[Window * Channels]{};
+  FloatType mMean[Channels]{};
+  FloatType mSquares[Channels]{};
+  std::size_t mCount = 0;
+};
+
+/// Rolling minima of the last @tparam Window samples of @tparam Channels channels.
+template<typename Quantity, std::size_t Channels, std::size_t Window>
+using MultiChannelRollingMinimum =
+    detail::MultiChannelRollingExtremum<Quantity, Channels, Window, detail::MinimumComparison>;
+
+/// Rolling maxima of the last @tparam Window samples of @tparam Channels channels.
+template<typename Quantity, std::size_t Channels, std::size_t Window>
+using MultiChannelRollingMaximum =
+    detail::MultiChannelRollingExtremum<Quantity, Channels, Window, detail::MaximumComparison>;
+
+} // End of namespace units.
\ No newline at end of file
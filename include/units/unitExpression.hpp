@@ -0,0 +1,596 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#if __cplusplus < 202002L
+#error "units/unitExpression.hpp requires C++20 for string literal template arguments."
+#endif
+
+#include "affineQuantity.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/// Compile-time parser of unit expressions such as "kg*m/s^2". The expression is evaluated into
+/// exponents and a scale by a consteval function and the PhysicalUnits type is spelled out directly
+/// from the result, so no MultiplyPhysicalUnits / DividePhysicalUnits chain is instantiated and
+/// nothing is left to do at runtime.
+///
+/// Grammar:
+///     expression  := factor (('*' | '/') factor)*
+///     factor      := [prefix] symbol ['^' exponent] | '1'
+///     exponent    := ['-'] digits | '(' ['-'] digits '/' digits ')'
+///
+/// '/' divides by the single factor that follows it i.e. "m/s/s" is "m/s^2". Whitespace is
+/// ignored. Symbols: m, g, kg, s, min, h, A, K, mol, cd, rad, in, ft, lb. The S.I. ones among
+/// them, m, g, s, A, K, mol, cd and rad, take the S.I. prefixes Q, R, Y, Z, E, P, T, G, M, k, h,
+/// da, d, c, m, u (micro), n, p, f, a, z, y, r and q, e.g. "km", "ms" or "umol".
+///
+/// Scales are carried as prime factorizations, so a product that overflows std::intmax_t, e.g.
+/// "km^7", yields a FactoredScale exactly as MultiplyScales would.
+///
+/// A malformed expression fails to compile with a call to one of the detail::unitExpression*
+/// functions below naming the problem.
+
+namespace units
+{
+
+/// @brief  String literal usable as a template argument.
+/// @tparam N   Size of the literal including the terminating null character.
+template<std::size_t N>
+struct FixedString
+{
+  constexpr FixedString(
+      const char (&input)[N]) noexcept(true) // NOLINT(google-explicit-constructor)
+  {
+    for(std::size_t index = 0; index < N; ++index)
+    {
+      mCharacters[index] = input[index];
+    }
+  }
+
+  static constexpr std::size_t kSize = N - 1;
+
+  char mCharacters[N]{};
+};
+
+namespace detail
+{
+
+// Diagnostics: calling any of these during constant evaluation aborts it with the function's name.
+inline void unitExpressionUnknownSymbol() {}
+
+inline void unitExpressionUnexpectedCharacter() {}
+
+inline void unitExpressionMalformedExponent() {}
+
+inline void unitExpressionScaleOverflow() {}
+
+inline void unitExpressionIrrationalScale() {}
+
+/// Rational number in lowest terms with a positive denominator.
+struct Fraction
+{
+  std::intmax_t mNumerator;
+  std::intmax_t mDenominator;
+};
+
+consteval Fraction reduce(std::intmax_t numerator, std::intmax_t denominator)
+{
+  if(denominator < 0)
+  {
+    numerator = -numerator;
+    denominator = -denominator;
+  }
+
+  const std::intmax_t divisor = greatestCommonDivisor(numerator, denominator);
+  return Fraction{ numerator / divisor, denominator / divisor };
+}
+
+consteval std::intmax_t checkedMultiply(const std::intmax_t lhs, const std::intmax_t rhs)
+{
+  if(not canMultiply(lhs, rhs))
+  {
+    unitExpressionScaleOverflow();
+  }
+
+  return lhs * rhs;
+}
+
+consteval Fraction add(const Fraction lhs, const Fraction rhs)
+{
+  return reduce(
+      lhs.mNumerator * rhs.mDenominator + rhs.mNumerator * lhs.mDenominator,
+      lhs.mDenominator * rhs.mDenominator);
+}
+
+/// Positive rational scale as the exponents of its prime factors sorted by ascending primes, the
+/// consteval counterpart of FactoredScale. Products only add exponents, so no chain of scales can
+/// overflow.
+struct Factorization
+{
+  static constexpr std::size_t kCapacity = 16;
+
+  struct Factor
+  {
+    std::intmax_t mPrime;
+    std::intmax_t mExponent;
+  };
+
+  Factor mFactors[kCapacity];
+  std::size_t mSize;
+};
+
+/// Multiplies @param scale by @param prime ^ @param exponent, keeping the factors sorted and
+/// dropping those whose exponent cancels to 0.
+consteval void multiplyFactor(
+    Factorization& scale,
+    const std::intmax_t prime,
+    const std::intmax_t exponent)
+{
+  std::size_t index = 0;
+  while(index < scale.mSize && scale.mFactors[index].mPrime < prime)
+  {
+    ++index;
+  }
+
+  if(index < scale.mSize && scale.mFactors[index].mPrime == prime)
+  {
+    scale.mFactors[index].mExponent += exponent;
+
+    if(scale.mFactors[index].mExponent == 0)
+    {
+      for(; index + 1 < scale.mSize; ++index)
+      {
+        scale.mFactors[index] = scale.mFactors[index + 1];
+      }
+
+      --scale.mSize;
+    }
+
+    return;
+  }
+
+  if(scale.mSize == Factorization::kCapacity)
+  {
+    unitExpressionScaleOverflow();
+  }
+
+  for(std::size_t shifted = scale.mSize; shifted > index; --shifted)
+  {
+    scale.mFactors[shifted] = scale.mFactors[shifted - 1];
+  }
+
+  scale.mFactors[index] = Factorization::Factor{ prime, exponent };
+  ++scale.mSize;
+}
+
+consteval Factorization factorize(std::intmax_t numerator, std::intmax_t denominator)
+{
+  Factorization result{};
+
+  for(; numerator > 1; numerator = removeFactor(numerator, smallestPrimeFactor(numerator)))
+  {
+    const std::intmax_t prime = smallestPrimeFactor(numerator);
+    multiplyFactor(result, prime, multiplicity(numerator, prime));
+  }
+
+  for(; denominator > 1; denominator = removeFactor(denominator, smallestPrimeFactor(denominator)))
+  {
+    const std::intmax_t prime = smallestPrimeFactor(denominator);
+    multiplyFactor(result, prime, -multiplicity(denominator, prime));
+  }
+
+  return result;
+}
+
+consteval Factorization multiply(Factorization lhs, const Factorization& rhs)
+{
+  for(std::size_t index = 0; index < rhs.mSize; ++index)
+  {
+    multiplyFactor(lhs, rhs.mFactors[index].mPrime, rhs.mFactors[index].mExponent);
+  }
+
+  return lhs;
+}
+
+/// Exponents of the seven base dimensions (L, M, T, I, K, N, J) and the scale of a unit.
+struct UnitExpression
+{
+  Fraction mExponents[7];
+  Factorization mScale;
+};
+
+consteval UnitExpression dimensionless()
+{
+  UnitExpression result{};
+
+  for(auto& exponent: result.mExponents)
+  {
+    exponent = Fraction{ 0, 1 };
+  }
+
+  return result;
+}
+
+/// Dimension index of a symbol without dimensions, e.g. rad.
+constexpr std::size_t kNoDimension = 7;
+
+/// Unit symbol of the grammar. Only the S.I. ones take a prefix.
+struct UnitSymbol
+{
+  const char* mName;
+  std::size_t mDimension;
+  std::intmax_t mScaleNumerator;
+  std::intmax_t mScaleDenominator;
+  bool mPrefixable;
+};
+
+inline constexpr UnitSymbol kUnitSymbols[] = {
+  { "m", 0, 1, 1, true },
+  { "in", 0, 254, 10000, false },
+  { "ft", 0, 3048, 10000, false },
+  { "kg", 1, 1, 1, false },
+  { "g", 1, 1, 1000, true },
+  { "lb", 1, 45359237, 100000000, false },
+  { "s", 2, 1, 1, true },
+  { "min", 2, 60, 1, false },
+  { "h", 2, 3600, 1, false },
+  { "A", 3, 1, 1, true },
+  { "K", 4, 1, 1, true },
+  { "mol", 5, 1, 1, true },
+  { "cd", 6, 1, 1, true },
+  { "rad", kNoDimension, 1, 1, true },
+};
+
+/// S.I. prefix symbol and its power of ten. 'u' stands for micro.
+struct PrefixSymbol
+{
+  const char* mName;
+  std::intmax_t mPowerOfTen;
+};
+
+inline constexpr PrefixSymbol kPrefixSymbols[] = {
+  { "Q", 30 },  { "R", 27 },  { "Y", 24 },  { "Z", 21 },  { "E", 18 },  { "P", 15 },
+  { "T", 12 },  { "G", 9 },   { "M", 6 },   { "k", 3 },   { "h", 2 },   { "da", 1 },
+  { "d", -1 },  { "c", -2 },  { "m", -3 },  { "u", -6 },  { "n", -9 },  { "p", -12 },
+  { "f", -15 }, { "a", -18 }, { "z", -21 }, { "y", -24 }, { "r", -27 }, { "q", -30 },
+};
+
+consteval bool matches(const char* begin, const std::size_t size, const char* symbol)
+{
+  std::size_t index = 0;
+
+  for(; index < size; ++index)
+  {
+    if(symbol[index] != begin[index])
+    {
+      return false;
+    }
+  }
+
+  return symbol[index] == '\0';
+}
+
+consteval std::size_t length(const char* symbol)
+{
+  std::size_t size = 0;
+  while(symbol[size] != '\0')
+  {
+    ++size;
+  }
+
+  return size;
+}
+
+consteval UnitExpression unitOf(const UnitSymbol& symbol)
+{
+  UnitExpression result = dimensionless();
+
+  if(symbol.mDimension != kNoDimension)
+  {
+    result.mExponents[symbol.mDimension] = Fraction{ 1, 1 };
+  }
+
+  result.mScale = factorize(symbol.mScaleNumerator, symbol.mScaleDenominator);
+  return result;
+}
+
+/// Unprefixed symbols are matched first, so that e.g. "min", "kg", "cd" and "h" keep their
+/// meaning; otherwise the symbol is read as an S.I. prefix followed by a prefixable unit.
+consteval UnitExpression lookupSymbol(const char* begin, const std::size_t size)
+{
+  for(const auto& symbol: kUnitSymbols)
+  {
+    if(matches(begin, size, symbol.mName))
+    {
+      return unitOf(symbol);
+    }
+  }
+
+  for(const auto& prefix: kPrefixSymbols)
+  {
+    const std::size_t prefixSize = length(prefix.mName);
+
+    if(size <= prefixSize || not matches(begin, prefixSize, prefix.mName))
+    {
+      continue;
+    }
+
+    for(const auto& symbol: kUnitSymbols)
+    {
+      if(symbol.mPrefixable && matches(begin + prefixSize, size - prefixSize, symbol.mName))
+      {
+        UnitExpression result = unitOf(symbol);
+        multiplyFactor(result.mScale, 2, prefix.mPowerOfTen);
+        multiplyFactor(result.mScale, 5, prefix.mPowerOfTen);
+        return result;
+      }
+    }
+  }
+
+  unitExpressionUnknownSymbol();
+  return dimensionless();
+}
+
+/// @brief  Raises @param base to the rational @param exponent. A power whose scale has a prime
+///         with a non-integer exponent is not rational and is rejected.
+consteval UnitExpression power(const UnitExpression& base, const Fraction exponent)
+{
+  UnitExpression result = base;
+
+  for(auto& dimension: result.mExponents)
+  {
+    dimension = reduce(
+        dimension.mNumerator * exponent.mNumerator,
+        dimension.mDenominator * exponent.mDenominator);
+  }
+
+  for(std::size_t index = 0; index < result.mScale.mSize; ++index)
+  {
+    const std::intmax_t scaled =
+        checkedMultiply(result.mScale.mFactors[index].mExponent, exponent.mNumerator);
+
+    if(scaled % exponent.mDenominator != 0)
+    {
+      unitExpressionIrrationalScale();
+    }
+
+    result.mScale.mFactors[index].mExponent = scaled / exponent.mDenominator;
+  }
+
+  return result;
+}
+
+consteval UnitExpression combine(const UnitExpression& lhs, const UnitExpression& rhs)
+{
+  UnitExpression result{};
+
+  for(std::size_t index = 0; index < 7; ++index)
+  {
+    result.mExponents[index] = add(lhs.mExponents[index], rhs.mExponents[index]);
+  }
+
+  result.mScale = multiply(lhs.mScale, rhs.mScale);
+  return result;
+}
+
+consteval bool isLetter(const char character)
+{
+  return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+}
+
+consteval bool isDigit(const char character)
+{
+  return character >= '0' && character <= '9';
+}
+
+/// Recursive-descent parser over the characters of a unit expression.
+class UnitExpressionParser
+{
+public:
+  consteval UnitExpressionParser(const char* characters, const std::size_t size):
+      mCharacters(characters),
+      mSize(size),
+      mPosition(0)
+  {
+  }
+
+  consteval UnitExpression parse()
+  {
+    UnitExpression result = parseFactor();
+
+    for(skipSpaces(); mPosition < mSize; skipSpaces())
+    {
+      const char operation = mCharacters[mPosition++];
+
+      if(operation == '*')
+      {
+        result = combine(result, parseFactor());
+      }
+      else if(operation == '/')
+      {
+        result = combine(result, power(parseFactor(), Fraction{ -1, 1 }));
+      }
+      else
+      {
+        unitExpressionUnexpectedCharacter();
+      }
+    }
+
+    return result;
+  }
+
+private:
+  consteval void skipSpaces()
+  {
+    while(mPosition < mSize && mCharacters[mPosition] == ' ')
+    {
+      ++mPosition;
+    }
+  }
+
+  consteval std::intmax_t parseInteger()
+  {
+    skipSpaces();
+    const bool negative = mPosition < mSize && mCharacters[mPosition] == '-';
+    mPosition += negative ? 1 : 0;
+
+    if(mPosition == mSize || !isDigit(mCharacters[mPosition]))
+    {
+      unitExpressionMalformedExponent();
+    }
+
+    std::intmax_t value = 0;
+
+    while(mPosition < mSize && isDigit(mCharacters[mPosition]))
+    {
+      value = value * 10 + (mCharacters[mPosition++] - '0');
+    }
+
+    return negative ? -value : value;
+  }
+
+  consteval Fraction parseExponent()
+  {
+    skipSpaces();
+
+    if(mPosition < mSize && mCharacters[mPosition] == '(')
+    {
+      ++mPosition;
+      const std::intmax_t numerator = parseInteger();
+      skipSpaces();
+
+      if(mPosition == mSize || mCharacters[mPosition++] != '/')
+      {
+        unitExpressionMalformedExponent();
+      }
+
+      const std::intmax_t denominator = parseInteger();
+      skipSpaces();
+
+      if(denominator == 0 || mPosition == mSize || mCharacters[mPosition++] != ')')
+      {
+        unitExpressionMalformedExponent();
+      }
+
+      return reduce(numerator, denominator);
+    }
+
+    return Fraction{ parseInteger(), 1 };
+  }
+
+  consteval UnitExpression parseFactor()
+  {
+    skipSpaces();
+
+    if(mPosition < mSize && mCharacters[mPosition] == '1')
+    {
+      ++mPosition;
+      return dimensionless();
+    }
+
+    const std::size_t begin = mPosition;
+
+    while(mPosition < mSize && isLetter(mCharacters[mPosition]))
+    {
+      ++mPosition;
+    }
+
+    if(begin == mPosition)
+    {
+      unitExpressionUnexpectedCharacter();
+    }
+
+    const UnitExpression symbol = lookupSymbol(mCharacters + begin, mPosition - begin);
+    skipSpaces();
+
+    if(mPosition < mSize && mCharacters[mPosition] == '^')
+    {
+      ++mPosition;
+      return power(symbol, parseExponent());
+    }
+
+    return symbol;
+  }
+
+  const char* mCharacters;
+  std::size_t mSize;
+  std::size_t mPosition;
+};
+
+/// Evaluated unit expression @tparam Expression.
+template<FixedString Expression>
+inline constexpr UnitExpression kUnitExpression =
+    UnitExpressionParser(Expression.mCharacters, Expression.kSize).parse();
+
+template<FixedString Expression, std::size_t Dimension>
+using ExponentRatio = std::ratio<
+    kUnitExpression<Expression>.mExponents[Dimension].mNumerator,
+    kUnitExpression<Expression>.mExponents[Dimension].mDenominator>;
+
+/// Scale of the unit expression @tparam Expression, normalised like the result of MultiplyScales:
+/// a std::ratio whenever it fits in one and a FactoredScale otherwise.
+template<
+    FixedString Expression,
+    typename Indices = std::make_index_sequence<kUnitExpression<Expression>.mScale.mSize>>
+struct ExpressionScale;
+
+template<FixedString Expression, std::size_t... Indices>
+struct ExpressionScale<Expression, std::index_sequence<Indices...>>
+{
+  using Type = typename Normalize<FactoredScale<PrimePower<
+      kUnitExpression<Expression>.mScale.mFactors[Indices].mPrime,
+      kUnitExpression<Expression>.mScale.mFactors[Indices].mExponent>...>>::Type;
+};
+
+} // End of namespace detail.
+
+/// @brief  Physical units described by the unit expression @tparam Expression. The exponents and
+///         the scale are reduced, so the type is the same one that a chain of MultiplyPhysicalUnits
+///         / DividePhysicalUnits under PreserveScalePolicy would arrive at.
+///
+///         EG: Unit<"kg*m/s^2"> is PhysicalUnits<PhysicalDimensions<ratio<1>, ratio<1>, ratio<-2>>,
+///             ratio<1>>.
+///             Unit<"ft/s"> is PhysicalUnits<Length / Time, ratio<381, 1250>>.
+///             Unit<"km"> is Kilo<MetresPhysicalUnit>.
+template<FixedString Expression>
+using Unit = PhysicalUnits<
+    PhysicalDimensions<
+        detail::ExponentRatio<Expression, 0>,
+        detail::ExponentRatio<Expression, 1>,
+        detail::ExponentRatio<Expression, 2>,
+        detail::ExponentRatio<Expression, 3>,
+        detail::ExponentRatio<Expression, 4>,
+        detail::ExponentRatio<Expression, 5>,
+        detail::ExponentRatio<Expression, 6>>,
+    typename detail::ExpressionScale<Expression>::Type>;
+
+/// @brief  Affine quantity in the units described by the unit expression @tparam Expression.
+///
+///         EG: Quantity<"m/s^2">(9.81)
+template<FixedString Expression, typename FloatType = double>
+using Quantity = AffineQuantity<Unit<Expression>, FloatType>;
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,343 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+module;
+
+#include <units/angle.hpp>
+#include <units/arrow.hpp>
+#include <units/chrono.hpp>
+#include <units/constants.hpp>
+#include <units/dual.hpp>
+#include <units/filter.hpp>
+#include <units/histogram.hpp>
+#include <units/imperial.hpp>
+#include <units/io.hpp>
+#include <units/literals.hpp>
+#include <units/parallel.hpp>
+#include <units/pmr.hpp>
+#include <units/precision.hpp>
+#include <units/prefixes.hpp>
+#include <units/quantityMatrix.hpp>
+#include <units/quantized.hpp>
+#include <units/resampler.hpp>
+#include <units/si.hpp>
+#include <units/statistics.hpp>
+
+#if defined(__unix__) or defined(__APPLE__)
+#include <units/sharedRing.hpp>
+#endif
+
+#include <units/unitExpression.hpp>
+
+export module units;
+
+/// Re-exports the header-only library as the named module 'units'. Every public entity of the
+/// headers has to be listed here; the headers themselves remain the single source of truth.
+export namespace units
+{
+
+// physicalDimensions.hpp
+using units::PhysicalDimensions;
+using units::MultiplyPhysicalDimensions;
+using units::DividePhysicalDimensions;
+using units::Angle;
+using units::Length;
+using units::Mass;
+using units::Time;
+using units::Current;
+using units::Temperature;
+using units::Substance;
+using units::LuminousIntensity;
+using units::AngularSpeed;
+using units::Speed;
+using units::Area;
+using units::Volume;
+using units::Acceleration;
+using units::Force;
+
+// scale.hpp
+using units::PrimePower;
+using units::FactoredScale;
+using units::MultiplyScales;
+using units::DivideScales;
+using units::ScaleValue;
+
+// representation.hpp
+using units::RepresentationTraits;
+
+// physicalUnits.hpp
+using units::PhysicalUnits;
+using units::PhysicalUnitsScale;
+using units::PreserveScalePolicy;
+using units::CanonicalScalePolicy;
+using units::DefaultScalePolicy;
+using units::MultiplyPhysicalUnits;
+using units::DividePhysicalUnits;
+
+// affineQuantity.hpp
+using units::ImplicitConversionPolicy;
+using units::ExplicitConversionPolicy;
+using units::AffineQuantity;
+using units::ExplicitQuantity;
+using units::quantityCast;
+using units::multiply;
+using units::divide;
+using units::operator+;
+using units::operator-;
+using units::operator*;
+using units::operator/;
+using units::operator==;
+using units::operator!=;
+using units::operator<;
+using units::operator<=;
+using units::operator>;
+using units::operator>=;
+
+// conversionAudit.hpp
+#if defined(UNITS_CONVERSION_AUDIT)
+namespace audit
+{
+using units::audit::ConversionCount;
+using units::audit::record;
+using units::audit::flush;
+using units::audit::report;
+using units::audit::reset;
+} // End of namespace audit.
+#endif
+
+// angle.hpp
+using units::PiRatio;
+using units::DegreesPhysicalUnit;
+using units::TurnsPhysicalUnit;
+using units::Degrees;
+using units::Turns;
+using units::BinaryAngle;
+using units::toBinaryAngles;
+using units::fromBinaryAngles;
+using units::sinCos;
+
+// arrow.hpp
+using units::exportArrowColumn;
+using units::ImportedArrowColumn;
+
+// chrono.hpp
+using units::DurationQuantity;
+using units::fromDuration;
+using units::toDuration;
+
+// filter.hpp
+using units::BitmaskWord;
+using units::bitmaskWords;
+using units::filterLess;
+using units::filterLessEqual;
+using units::filterGreater;
+using units::filterGreaterEqual;
+using units::filterRange;
+using units::countSelected;
+using units::selectionVector;
+using units::compact;
+
+// constants.hpp
+namespace constants
+{
+using units::constants::SpeedOfLightPhysicalUnit;
+using units::constants::PlanckConstantPhysicalUnit;
+using units::constants::ElementaryChargePhysicalUnit;
+using units::constants::BoltzmannConstantPhysicalUnit;
+using units::constants::AvogadroConstantPhysicalUnit;
+using units::constants::MolarGasConstantPhysicalUnit;
+using units::constants::FaradayConstantPhysicalUnit;
+using units::constants::CaesiumFrequencyPhysicalUnit;
+using units::constants::LuminousEfficacyPhysicalUnit;
+using units::constants::StandardGravityPhysicalUnit;
+using units::constants::StandardAtmospherePhysicalUnit;
+using units::constants::GravitationalConstantPhysicalUnit;
+using units::constants::FineStructureConstantPhysicalUnit;
+using units::constants::VacuumMagneticPermeabilityPhysicalUnit;
+using units::constants::VacuumElectricPermittivityPhysicalUnit;
+using units::constants::StefanBoltzmannConstantPhysicalUnit;
+using units::constants::kSpeedOfLight;
+using units::constants::kPlanckConstant;
+using units::constants::kElementaryCharge;
+using units::constants::kBoltzmannConstant;
+using units::constants::kAvogadroConstant;
+using units::constants::kMolarGasConstant;
+using units::constants::kFaradayConstant;
+using units::constants::kCaesiumFrequency;
+using units::constants::kLuminousEfficacy;
+using units::constants::kStandardGravity;
+using units::constants::kStandardAtmosphere;
+using units::constants::kGravitationalConstant;
+using units::constants::kElectronMass;
+using units::constants::kProtonMass;
+using units::constants::kFineStructureConstant;
+using units::constants::kVacuumMagneticPermeability;
+using units::constants::kVacuumElectricPermittivity;
+using units::constants::kStefanBoltzmannConstant;
+} // End of namespace constants.
+using units::LightSecondsPhysicalUnit;
+using units::LightSeconds;
+
+// dual.hpp
+using units::Dual;
+using units::sqrt;
+using units::exp;
+using units::log;
+using units::sin;
+using units::cos;
+using units::pow;
+using units::seedVariable;
+using units::primal;
+using units::partial;
+
+// histogram.hpp
+using units::LinearHistogram;
+using units::LogHistogram;
+
+// io.hpp
+using units::operator<<;
+
+// literals.hpp
+namespace literals
+{
+using units::literals::operator""_rad;
+using units::literals::operator""_m;
+using units::literals::operator""_kg;
+using units::literals::operator""_s;
+using units::literals::operator""_A;
+using units::literals::operator""_K;
+using units::literals::operator""_mol;
+using units::literals::operator""_cd;
+using units::literals::operator""_in;
+using units::literals::operator""_ft;
+using units::literals::operator""_lb;
+} // End of namespace literals.
+
+// parallel.hpp
+namespace parallel
+{
+using units::parallel::kChunkBytes;
+using units::parallel::kCacheLineBytes;
+using units::parallel::ThreadPool;
+using units::parallel::Buffer;
+using units::parallel::transform;
+} // End of namespace parallel.
+
+// pmr.hpp
+namespace pmr
+{
+using units::pmr::QuantityVector;
+using units::pmr::BumpArena;
+using units::pmr::transform;
+using units::pmr::convert;
+} // End of namespace pmr.
+
+// precision.hpp
+using units::FastPrecision;
+using units::ExactRatioPrecision;
+using units::DoubleDoublePrecision;
+
+// prefixes.hpp
+#define UNITS_EXPORT_PREFIX(Prefix, ...) using units::Prefix;
+#define UNITS_EXPORT_PREFIXED_UNIT(Prefix, stem, Quantity, Units)                                  \
+  using units::Prefix##stem##PhysicalUnit;                                                         \
+  using units::Prefix##stem;
+using units::Prefix;
+UNITS_SI_PREFIXES(UNITS_EXPORT_PREFIX, )
+using units::GramsPhysicalUnit;
+using units::Grams;
+UNITS_SI_PREFIXED_UNITS(UNITS_EXPORT_PREFIXED_UNIT)
+#undef UNITS_EXPORT_PREFIXED_UNIT
+#undef UNITS_EXPORT_PREFIX
+
+// quantityMatrix.hpp
+using units::PhysicalUnitsList;
+using units::InversePhysicalUnitsList;
+using units::StateVector;
+using units::QuantityMatrix;
+using units::CovarianceMatrix;
+using units::JacobianMatrix;
+
+// quantized.hpp
+using units::QuantizedQuantity;
+using units::quantize;
+using units::dequantize;
+
+// resampler.hpp
+using units::ZeroOrderHold;
+using units::LinearInterpolation;
+using units::Decimation;
+using units::Resampler;
+
+// sharedRing.hpp
+#if defined(__unix__) or defined(__APPLE__)
+using units::SharedRingProducer;
+using units::SharedRingConsumer;
+#endif
+
+// span.hpp
+using units::QuantitySpan;
+
+// statistics.hpp
+using units::VarianceQuantity;
+using units::ExponentialMovingAverage;
+using units::RollingStatistics;
+using units::RollingMinimum;
+using units::RollingMaximum;
+using units::MultiChannelExponentialMovingAverage;
+using units::MultiChannelRollingStatistics;
+using units::MultiChannelRollingMinimum;
+using units::MultiChannelRollingMaximum;
+
+// si.hpp
+using units::RadiansPhysicalUnit;
+using units::MetresPhysicalUnit;
+using units::KilogramsPhysicalUnit;
+using units::SecondsPhysicalUnit;
+using units::AmperesPhysicalUnit;
+using units::KelvinPhysicalUnit;
+using units::MolesPhysicalUnits;
+using units::CandelaPhysicalUnit;
+using units::Radians;
+using units::Metres;
+using units::Kilograms;
+using units::Seconds;
+using units::Ampere;
+using units::KelvinTemperatureDifference;
+using units::Moles;
+using units::Candela;
+
+// imperial.hpp
+using units::InchesPhysicalUnit;
+using units::FeetPhysicalUnit;
+using units::PoundsPhysicalUnit;
+using units::Inches;
+using units::Feet;
+using units::Pounds;
+
+// unitExpression.hpp
+using units::FixedString;
+using units::Unit;
+using units::Quantity;
+
+} // End of namespace units.
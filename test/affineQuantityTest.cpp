@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#include <chrono>
 #include <gtest/gtest.h>
 #include <units/imperial.hpp>
 #include <units/si.hpp>
@@ -256,6 +257,38 @@ TEST(AffineQuantity, DivisionOperator)
   EXPECT_EQ(0.8, area1.scalar());
 }
 
+TEST(AffineQuantity, CanonicalMultiplication)
+{
+  const Metres m1(4.0);
+  const Inches i1(5.0);
+
+  const auto area1 = multiply<CanonicalScalePolicy>(m1, i1);
+
+  static_assert(
+      std::is_same<
+          PhysicalUnits<Area, std::ratio<1>>,
+          typename decltype(area1)::PhysicalUnits>::value,
+      "Canonical multiplication must yield coherent S.I. physical units");
+
+  EXPECT_DOUBLE_EQ(0.508, area1.scalar());
+  EXPECT_DOUBLE_EQ(1.508, (area1 + Metres(1.0) * Metres(1.0)).scalar());
+}
+
+TEST(AffineQuantity, CanonicalDivision)
+{
+  const Metres m1(4.0);
+  const Inches i1(5.0);
+
+  const auto ratio1 = divide<CanonicalScalePolicy>(i1, m1);
+
+  static_assert(
+      std::is_same<PhysicalUnits<Angle, std::ratio<1>>, typename decltype(ratio1)::PhysicalUnits>::
+          value,
+      "Canonical division must yield coherent S.I. physical units");
+
+  EXPECT_DOUBLE_EQ(0.03175, ratio1.scalar());
+}
+
 TEST(AffineQuantity, EqualityOperator)
 {
   EXPECT_TRUE(Metres(5.0) == Metres(5.0));
@@ -337,4 +370,83 @@ TEST(AffineQuantity, HeterogeneousGreaterThanOrEqualToInequalityOperator)
 }
 
 
+TEST(AffineQuantity, OperatorsDoNotHijackUnrelatedTypes)
+{
+  // The operators of affine quantities must not take part in overload resolution for other types
+  // found in, or brought into, namespace units.
+  EXPECT_TRUE(std::chrono::seconds(1) < std::chrono::milliseconds(1500));
+  EXPECT_TRUE(
+      std::chrono::seconds(1) + std::chrono::milliseconds(500) == std::chrono::milliseconds(1500));
+}
+
+template<typename Lhs, typename Rhs, typename = void>
+struct IsAddable: std::false_type
+{
+};
+
+template<typename Lhs, typename Rhs>
+struct IsAddable<Lhs, Rhs, decltype(void(std::declval<Lhs>() + std::declval<Rhs>()))>
+    : std::true_type
+{
+};
+
+template<typename Lhs, typename Rhs, typename = void>
+struct IsLessThanComparable: std::false_type
+{
+};
+
+template<typename Lhs, typename Rhs>
+struct IsLessThanComparable<Lhs, Rhs, decltype(void(std::declval<Lhs>() < std::declval<Rhs>()))>
+    : std::true_type
+{
+};
+
+TEST(AffineQuantity, ExplicitConversionPolicy)
+{
+  static_assert(
+      not IsAddable<ExplicitQuantity<Metres>, Inches>::value and
+          not IsAddable<Inches, ExplicitQuantity<Metres>>::value and
+          not IsLessThanComparable<ExplicitQuantity<Metres>, Inches>::value and
+          not IsLessThanComparable<Metres, ExplicitQuantity<Inches>>::value,
+      "Operators that would rescale under ExplicitConversionPolicy are required to be detectably "
+      "absent");
+
+  static_assert(
+      IsAddable<ExplicitQuantity<Metres>, Metres>::value and IsAddable<Metres, Inches>::value and
+          IsLessThanComparable<Metres, ExplicitQuantity<Metres>>::value,
+      "Operators that do not rescale are required to be available under every policy");
+
+  static_assert(
+      not std::is_convertible<Metres, ExplicitQuantity<Inches>>::value and
+          not std::is_convertible<ExplicitQuantity<Metres>, Inches>::value,
+      "Rescaling is required to be explicit under ExplicitConversionPolicy");
+
+  static_assert(
+      std::is_convertible<Metres, ExplicitQuantity<Metres>>::value and
+          std::is_convertible<ExplicitQuantity<Metres>, Metres>::value,
+      "Identical physical units are required to interoperate across conversion policies");
+
+  const ExplicitQuantity<Metres> metres(1.0);
+  const auto sum = metres + Metres(2.0);
+  static_assert(
+      std::is_same<const ExplicitQuantity<Metres>, decltype(sum)>::value,
+      "The result of a mixed-policy operation is required to take the type of the LHS");
+
+  EXPECT_DOUBLE_EQ(3.0, sum.scalar());
+  EXPECT_TRUE(Metres(1.0) == metres);
+
+  const auto inches = quantityCast<ExplicitQuantity<Inches>>(metres);
+  EXPECT_DOUBLE_EQ(1.0 / 0.0254, inches.scalar());
+  EXPECT_DOUBLE_EQ(0.0254, quantityCast<Metres>(Inches(1.0)).scalar());
+
+  using IntegerMetres = AffineQuantity<MetresPhysicalUnit, int>;
+  EXPECT_EQ(2, quantityCast<IntegerMetres>(Inches(100.0)).scalar());
+
+  const auto area = metres * metres;
+  static_assert(
+      std::is_same<ExplicitConversionPolicy, typename decltype(area)::ConversionPolicy>::value,
+      "Products are required to keep the conversion policy of the LHS");
+}
+
+
 } // End of namespace units.
\ No newline at end of file
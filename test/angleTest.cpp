@@ -0,0 +1,163 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <units/angle.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+namespace units
+{
+
+using Heading = BinaryAngle<std::uint16_t>;
+
+constexpr double kPi = 3.14159265358979323846;
+
+TEST(Angle, StaticChecks)
+{
+  static_assert(
+      std::is_same<
+          std::ratio<8192, 45>,
+          typename PhysicalUnitsScale<
+              typename Heading::LSBPhysicalUnits,
+              DegreesPhysicalUnit,
+              double>::Result>::value,
+      "The degrees to BAM scale is required to be the exact rational 2^16 / 360");
+
+  static_assert(sizeof(Heading) == sizeof(std::uint16_t), "A binary angle is required to be bare");
+
+  EXPECT_DOUBLE_EQ(kPi, Radians(Degrees(180.0)).scalar());
+  EXPECT_DOUBLE_EQ(kPi / 2.0, Radians(Degrees(90.0)).scalar());
+  EXPECT_DOUBLE_EQ(2.0 * kPi, Radians(Turns(1.0)).scalar());
+}
+
+TEST(BinaryAngle, Conversions)
+{
+  EXPECT_EQ(16384U, Heading::fromAngle(Degrees(90.0)).count());
+  EXPECT_EQ(49152U, Heading::fromAngle(Degrees(-90.0)).count());
+  EXPECT_EQ(16384U, Heading::fromAngle(Degrees(450.0)).count());
+  EXPECT_EQ(16384U, Heading::fromAngle(Radians(kPi / 2.0)).count());
+  EXPECT_EQ(0U, Heading::fromAngle(Radians(std::numeric_limits<double>::quiet_NaN())).count());
+
+  EXPECT_DOUBLE_EQ(90.0, Heading(16384U).toAngle<Degrees>().scalar());
+  EXPECT_DOUBLE_EQ(-90.0, Heading(49152U).toAngle<Degrees>().scalar());
+  EXPECT_DOUBLE_EQ(-kPi, Heading(32768U).toAngle<Radians>().scalar());
+}
+
+TEST(BinaryAngle, Wraparound)
+{
+  const auto a = Heading::fromAngle(Degrees(170.0));
+  const auto b = Heading::fromAngle(Degrees(-170.0));
+
+  EXPECT_NEAR(-20.0, (a + a).toAngle<Degrees>().scalar(), 0.01);
+  EXPECT_NEAR(20.0, (b - a).toAngle<Degrees>().scalar(), 0.01);
+  EXPECT_NEAR(-20.0, (a - b).toAngle<Degrees>().scalar(), 0.01);
+  EXPECT_EQ(b, -a);
+  EXPECT_NE(a, b);
+}
+
+TEST(BinaryAngle, BulkMatchesScalar)
+{
+  using RadiansFloat = AffineQuantity<RadiansPhysicalUnit, float>;
+
+  std::vector<RadiansFloat> input;
+  for(int index = -500; index < 501; ++index)
+  {
+    input.emplace_back(float(index) * 0.37F);
+  }
+
+  input[3] = RadiansFloat(std::numeric_limits<float>::quiet_NaN());
+  input[4] = RadiansFloat(std::numeric_limits<float>::infinity());
+  input[5] = RadiansFloat(1.0e12F);
+
+  std::vector<Heading> headings(input.size());
+  toBinaryAngles(input.data(), input.size(), headings.data());
+
+  std::vector<RadiansFloat> output(input.size());
+  fromBinaryAngles(headings.data(), headings.size(), output.data());
+
+  for(std::size_t index = 0; index < input.size(); ++index)
+  {
+    ASSERT_EQ(Heading::fromAngle(input[index]), headings[index]) << index;
+    EXPECT_EQ(headings[index].toAngle<RadiansFloat>().scalar(), output[index].scalar());
+  }
+}
+
+TEST(BinaryAngle, SinCos)
+{
+  std::vector<BinaryAngle<std::uint32_t>> angles;
+  for(std::uint32_t index = 0; index < 1000; ++index)
+  {
+    angles.emplace_back(index * 4294967U);
+  }
+
+  std::vector<float> sines(angles.size());
+  std::vector<float> cosines(angles.size());
+  sinCos(angles.data(), angles.size(), sines.data(), cosines.data());
+
+  for(std::size_t index = 0; index < angles.size(); ++index)
+  {
+    const double radians = angles[index].toAngle<Radians>().scalar();
+    EXPECT_NEAR(std::sin(radians), sines[index], 2e-7);
+    EXPECT_NEAR(std::cos(radians), cosines[index], 2e-7);
+  }
+}
+
+TEST(BinaryAngle, SinCosBulkMatchesScalar)
+{
+  // Every 16-bit angle, an odd count so that the scalar tail runs as well.
+  std::vector<BinaryAngle<std::uint16_t>> angles;
+  for(std::uint32_t index = 0; index < 65536U; ++index)
+  {
+    angles.emplace_back(std::uint16_t(index));
+  }
+  angles.emplace_back(std::uint16_t(12345));
+
+  std::vector<float> sines(angles.size());
+  std::vector<float> cosines(angles.size());
+  sinCos(angles.data(), angles.size(), sines.data(), cosines.data());
+
+  for(std::size_t index = 0; index < angles.size(); ++index)
+  {
+    float sine = 0.0F;
+    float cosine = 0.0F;
+    sinCos(&angles[index], 1U, &sine, &cosine);
+
+    ASSERT_EQ(sine, sines[index]) << index;
+    ASSERT_EQ(cosine, cosines[index]) << index;
+
+    const double radians = angles[index].toAngle<Radians>().scalar();
+    ASSERT_NEAR(std::sin(radians), sines[index], 2e-7) << index;
+    ASSERT_NEAR(std::cos(radians), cosines[index], 2e-7) << index;
+  }
+
+  EXPECT_EQ(0.0F, sines[0]);
+  EXPECT_EQ(1.0F, cosines[0]);
+  EXPECT_EQ(1.0F, sines[16384]);
+  EXPECT_EQ(-1.0F, cosines[32768]);
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,156 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <units/arrow.hpp>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+namespace units
+{
+
+TEST(Arrow, ExportsWithoutCopying)
+{
+  const std::vector<Feet> heights{ Feet(1.0), Feet(2.0), Feet(3.0) };
+
+  ArrowSchema schema;
+  ArrowArray array;
+  exportArrowColumn(heights.data(), heights.size(), "height", &schema, &array);
+
+  EXPECT_STREQ("g", schema.format);
+  EXPECT_STREQ("height", schema.name);
+  EXPECT_EQ(0, schema.flags);
+  EXPECT_EQ(3, array.length);
+  EXPECT_EQ(0, array.null_count);
+  ASSERT_EQ(2, array.n_buffers);
+  EXPECT_EQ(nullptr, array.buffers[0]);
+  EXPECT_EQ(static_cast<const void*>(heights.data()), array.buffers[1]);
+
+  std::int32_t pairs;
+  std::memcpy(&pairs, schema.metadata, sizeof(pairs));
+  EXPECT_EQ(2, pairs);
+
+  schema.release(&schema);
+  array.release(&array);
+  EXPECT_EQ(nullptr, schema.release);
+  EXPECT_EQ(nullptr, array.release);
+}
+
+TEST(Arrow, RoundTripsZeroCopy)
+{
+  using Speed = decltype(Metres(1.0) / Seconds(1.0));
+  const std::vector<Speed> speeds{ Speed(1.5), Speed(2.5), Speed(3.5), Speed(4.5) };
+
+  ArrowSchema schema;
+  ArrowArray array;
+  exportArrowColumn(speeds.data(), speeds.size(), "speed", &schema, &array);
+  array.offset = 1;
+  array.length = 3;
+
+  const ImportedArrowColumn<Speed> column(&schema, &array);
+  EXPECT_EQ(nullptr, schema.release);
+  EXPECT_EQ(nullptr, array.release);
+  EXPECT_STREQ("speed", column.name());
+
+  const auto span = column.span();
+  ASSERT_EQ(3U, span.size());
+  EXPECT_EQ(speeds.data() + 1, span.data());
+  EXPECT_DOUBLE_EQ(4.5, span[2].scalar());
+}
+
+TEST(Arrow, OwnerIsReleasedWithTheArray)
+{
+  auto samples = std::make_shared<std::vector<AffineQuantity<MetresPhysicalUnit, float>>>(
+      8U, AffineQuantity<MetresPhysicalUnit, float>(2.0F));
+  const std::weak_ptr<const void> observer = samples;
+
+  ArrowSchema schema;
+  ArrowArray array;
+  exportArrowColumn(samples->data(), samples->size(), "", &schema, &array, samples);
+  EXPECT_STREQ("f", schema.format);
+
+  {
+    const ImportedArrowColumn<AffineQuantity<MetresPhysicalUnit, float>> column(&schema, &array);
+    EXPECT_EQ(8U, column.span().size());
+  }
+
+  EXPECT_FALSE(observer.expired());
+  samples.reset();
+  EXPECT_TRUE(observer.expired());
+}
+
+TEST(Arrow, RejectsColumnsOfOtherUnits)
+{
+  const std::vector<Metres> lengths(4U, Metres(1.0));
+
+  const auto import = [&lengths](auto quantity) {
+    using Quantity = decltype(quantity);
+    ArrowSchema schema;
+    ArrowArray array;
+    exportArrowColumn(lengths.data(), lengths.size(), "length", &schema, &array);
+    const ImportedArrowColumn<Quantity> column(&schema, &array);
+    return column.span().size();
+  };
+
+  EXPECT_EQ(4U, import(Metres()));
+  EXPECT_EQ(4U, import(ExplicitQuantity<Metres>()));
+  EXPECT_THROW(import(Feet()), std::runtime_error);
+  EXPECT_THROW(import(Seconds()), std::runtime_error);
+  EXPECT_THROW(import(AffineQuantity<MetresPhysicalUnit, float>()), std::runtime_error);
+}
+
+TEST(Arrow, RejectsColumnsWithoutFormatOrBuffers)
+{
+  const std::vector<Metres> lengths(4U, Metres(1.0));
+
+  ArrowSchema schema;
+  ArrowArray array;
+  exportArrowColumn(lengths.data(), lengths.size(), "length", &schema, &array);
+  schema.format = nullptr;
+  EXPECT_THROW(ImportedArrowColumn<Metres>(&schema, &array), std::runtime_error);
+  EXPECT_EQ(nullptr, schema.release);
+  EXPECT_EQ(nullptr, array.release);
+
+  exportArrowColumn(lengths.data(), lengths.size(), "length", &schema, &array);
+  array.buffers = nullptr;
+  EXPECT_THROW(ImportedArrowColumn<Metres>(&schema, &array), std::runtime_error);
+
+  exportArrowColumn(lengths.data(), lengths.size(), "length", &schema, &array);
+  array.buffers[1] = nullptr;
+  EXPECT_THROW(ImportedArrowColumn<Metres>(&schema, &array), std::runtime_error);
+  EXPECT_EQ(nullptr, array.release);
+
+  exportArrowColumn(lengths.data(), lengths.size(), "length", &schema, &array);
+  array.length = -1;
+  EXPECT_THROW(ImportedArrowColumn<Metres>(&schema, &array), std::runtime_error);
+
+  exportArrowColumn(lengths.data(), lengths.size(), "length", &schema, &array);
+  array.offset = -1;
+  EXPECT_THROW(ImportedArrowColumn<Metres>(&schema, &array), std::runtime_error);
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,122 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <units/chrono.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+TEST(Chrono, StaticChecks)
+{
+  static_assert(
+      std::is_same<
+          DurationQuantity<std::chrono::nanoseconds::rep, std::nano>,
+          decltype(fromDuration(std::chrono::nanoseconds(1)))>::value,
+      "The period of a duration is required to map onto the scale in fromDuration");
+
+  static_assert(
+      std::is_same<std::chrono::duration<double>, decltype(toDuration(Seconds(1.0)))>::value,
+      "The scale of a quantity is required to map onto the period in toDuration");
+
+  static_assert(
+      fromDuration(std::chrono::milliseconds(7)).scalar() == 7,
+      "fromDuration is required to be a constexpr no-op");
+}
+
+TEST(Chrono, IntegerTicksArePreserved)
+{
+  // Beyond 2^53 ns a round trip through double seconds would lose ticks.
+  const std::chrono::nanoseconds epoch(INT64_C(1700000000123456789));
+
+  const auto quantity = fromDuration(epoch);
+  EXPECT_EQ(epoch.count(), quantity.scalar());
+  EXPECT_EQ(epoch, toDuration(quantity));
+  EXPECT_EQ(
+      epoch + std::chrono::nanoseconds(1),
+      toDuration(quantity + DurationQuantity<std::int64_t, std::nano>(1)));
+
+  EXPECT_EQ(
+      INT64_C(1700000000123456),
+      toDuration<std::chrono::microseconds>(quantity).count());
+}
+
+TEST(Chrono, Conversions)
+{
+  EXPECT_DOUBLE_EQ(1.5e-6, fromDuration<Seconds>(std::chrono::nanoseconds(1500)).scalar());
+  EXPECT_EQ(1500000000, toDuration<std::chrono::nanoseconds>(Seconds(1.5)).count());
+  using Minutes = DurationQuantity<double, std::ratio<60>>;
+  EXPECT_DOUBLE_EQ(2.0, fromDuration<Minutes>(std::chrono::seconds(120)).scalar());
+}
+
+TEST(Chrono, IntegerConversionsAreExact)
+{
+  using Nanoseconds = DurationQuantity<std::int64_t, std::nano>;
+  using Microseconds = DurationQuantity<std::int64_t, std::micro>;
+  using Milliseconds = DurationQuantity<std::int64_t, std::milli>;
+
+  const Microseconds fromNanoseconds = Nanoseconds(1500);
+  EXPECT_EQ(1, fromNanoseconds.scalar());
+
+  const Milliseconds fromMicroseconds = Microseconds(-2500);
+  EXPECT_EQ(-2, fromMicroseconds.scalar());
+
+  const Nanoseconds fromMilliseconds = Milliseconds(3);
+  EXPECT_EQ(3000000, fromMilliseconds.scalar());
+
+  EXPECT_EQ(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(123456789))
+          .count(),
+      quantityCast<Microseconds>(Nanoseconds(123456789)).scalar());
+}
+
+TEST(Chrono, IntegerComparisonsAcrossUnits)
+{
+  using Nanoseconds = DurationQuantity<std::int64_t, std::nano>;
+  using Microseconds = DurationQuantity<std::int64_t, std::micro>;
+  using Milliseconds = DurationQuantity<std::int64_t, std::milli>;
+
+  EXPECT_FALSE(Nanoseconds(1500) == Microseconds(1));
+  EXPECT_FALSE(Microseconds(1) == Nanoseconds(1500));
+  EXPECT_TRUE(Microseconds(1) < Nanoseconds(1500));
+  EXPECT_TRUE(Microseconds(1) <= Nanoseconds(1500));
+  EXPECT_TRUE(Nanoseconds(1500) > Microseconds(1));
+  EXPECT_TRUE(Nanoseconds(1500) >= Microseconds(1));
+  EXPECT_TRUE(Microseconds(1) != Nanoseconds(1500));
+
+  EXPECT_TRUE(Microseconds(2) == Nanoseconds(2000));
+  EXPECT_TRUE(Milliseconds(1) == Microseconds(1000));
+  EXPECT_TRUE(Milliseconds(1) < Microseconds(1001));
+  EXPECT_FALSE(Milliseconds(1) < Microseconds(1000));
+  EXPECT_TRUE(Microseconds(999) < Milliseconds(1));
+
+  using Minutes = DurationQuantity<std::int64_t, std::ratio<60>>;
+  using Hours = DurationQuantity<std::int64_t, std::ratio<3600>>;
+  EXPECT_TRUE(Minutes(90) > Hours(1));
+  EXPECT_TRUE(Hours(1) < Minutes(61));
+  EXPECT_TRUE(Hours(2) == Minutes(120));
+}
+
+} // End of namespace units.
\ No newline at end of file
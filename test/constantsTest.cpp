@@ -0,0 +1,105 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <ratio>
+#include <type_traits>
+#include <units/constants.hpp>
+
+namespace units
+{
+
+/// Coherent S.I. units of the dimensions of @tparam Quantity.
+template<typename Quantity>
+using Coherent = AffineQuantity<
+    PhysicalUnits<typename Quantity::PhysicalUnits::PhysicalDimensions, std::ratio<1>>,
+    typename Quantity::FloatType>;
+
+TEST(Constants, ExactConstantsLiveInTheScale)
+{
+  static_assert(constants::kSpeedOfLight.scalar() == 1.0, "");
+  static_assert(constants::kPlanckConstant.scalar() == 1.0, "");
+
+  EXPECT_TRUE((std::is_same<
+               constants::PlanckConstantPhysicalUnit::Scale,
+               FactoredScale<
+                   PrimePower<2, -42>,
+                   PrimePower<3, 1>,
+                   PrimePower<5, -41>,
+                   PrimePower<7, 1>,
+                   PrimePower<6310543, 1>>>::value));
+
+  EXPECT_DOUBLE_EQ(
+      6.62607015e-34,
+      Coherent<decltype(constants::kPlanckConstant)>(constants::kPlanckConstant).scalar());
+  EXPECT_DOUBLE_EQ(
+      1.602176634e-19,
+      Coherent<decltype(constants::kElementaryCharge)>(constants::kElementaryCharge).scalar());
+  EXPECT_DOUBLE_EQ(
+      6.02214076e23,
+      Coherent<decltype(constants::kAvogadroConstant)>(constants::kAvogadroConstant).scalar());
+}
+
+TEST(Constants, ProductsOfExactConstantsStayExact)
+{
+  EXPECT_TRUE((std::ratio_equal<
+               constants::MolarGasConstantPhysicalUnit::Scale,
+               std::ratio<831446261815324, 100000000000000>>::value));
+
+  EXPECT_DOUBLE_EQ(
+      96485.33212331001,
+      Coherent<decltype(constants::kFaradayConstant)>(constants::kFaradayConstant).scalar());
+}
+
+TEST(Constants, SpeedOfLightTimesTimeIsLightSeconds)
+{
+  constexpr auto distance = multiply<PreserveScalePolicy>(constants::kSpeedOfLight, Seconds(2.0));
+
+  EXPECT_TRUE((std::is_same<const LightSeconds, decltype(distance)>::value));
+  EXPECT_EQ(2.0, distance.scalar());
+  EXPECT_EQ(599584916.0, Metres(distance).scalar());
+  static_assert(
+      PhysicalUnitsScale<MetresPhysicalUnit, LightSecondsPhysicalUnit, double>::kScale ==
+          299792458.0,
+      "The conversion to metres is the single factor c.");
+}
+
+TEST(Constants, DimensionsCarryThrough)
+{
+  const auto weight = multiply<PreserveScalePolicy>(Kilograms(2.0), constants::kStandardGravity);
+  EXPECT_DOUBLE_EQ(19.6133, Coherent<decltype(weight)>(weight).scalar());
+
+  const auto restEnergy = constants::kElectronMass * constants::kSpeedOfLight *
+                          constants::kSpeedOfLight;
+  EXPECT_TRUE((std::is_same<
+               PhysicalDimensions<std::ratio<2>, std::ratio<1>, std::ratio<-2>>,
+               decltype(restEnergy)::PhysicalUnits::PhysicalDimensions>::value));
+  EXPECT_NEAR(8.1871057769e-14, Coherent<decltype(restEnergy)>(restEnergy).scalar(), 1e-23);
+
+  const auto photonEnergy = constants::kPlanckConstant * constants::kCaesiumFrequency;
+  EXPECT_DOUBLE_EQ(
+      6.62607015e-34 * 9192631770.0,
+      Coherent<decltype(photonEnergy)>(photonEnergy).scalar());
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+TEST(ConversionAudit, CountsPerSite)
+{
+  audit::reset();
+
+  const Metres metres(1.0);
+  const unsigned line = __LINE__ + 3;
+  for(int index = 0; index < 3; ++index)
+  {
+    const Inches inches = metres;
+    EXPECT_GT(inches.scalar(), 0.0);
+  }
+
+  const unsigned sumLine = __LINE__ + 1;
+  const auto sum = metres + Inches(1.0);
+  EXPECT_DOUBLE_EQ(1.0254, sum.scalar());
+
+  const auto counts = audit::report();
+  ASSERT_EQ(2U, counts.size());
+
+  EXPECT_EQ(3U, counts[0].count);
+  EXPECT_EQ(line, counts[0].line);
+  EXPECT_NE(nullptr, std::strstr(counts[0].function, "CountsPerSite"));
+
+  EXPECT_EQ(1U, counts[1].count);
+  EXPECT_EQ(sumLine, counts[1].line);
+  EXPECT_NE(nullptr, std::strstr(counts[1].function, "CountsPerSite"));
+}
+
+TEST(ConversionAudit, AttributesOperatorsToTheirCallers)
+{
+  audit::reset();
+
+  using Nanoseconds = AffineQuantity<PhysicalUnits<Time, std::nano>, long>;
+  using Microseconds = AffineQuantity<PhysicalUnits<Time, std::micro>, long>;
+
+  const unsigned compareLine = __LINE__ + 1;
+  EXPECT_TRUE(Microseconds(1) < Nanoseconds(1500));
+
+  const unsigned productLine = __LINE__ + 1;
+  const auto area = multiply<CanonicalScalePolicy>(Metres(1.0), Inches(1.0));
+  EXPECT_DOUBLE_EQ(0.0254, area.scalar());
+
+  const auto counts = audit::report();
+  ASSERT_EQ(2U, counts.size());
+
+  for(const auto& count: counts)
+  {
+    EXPECT_EQ(1U, count.count);
+    EXPECT_TRUE(count.line == compareLine or count.line == productLine);
+    EXPECT_NE(nullptr, std::strstr(count.function, "AttributesOperatorsToTheirCallers"));
+  }
+
+  EXPECT_NE(counts[0].line, counts[1].line);
+}
+
+TEST(ConversionAudit, IgnoresUnitScaleAndConstantEvaluation)
+{
+  audit::reset();
+
+  constexpr Inches kInches = Metres(1.0);
+  static_assert(kInches.scalar() > 39.0, "Constant evaluation is required to keep working");
+
+  const Metres metres = Metres(1.0) + Metres(2.0);
+  EXPECT_DOUBLE_EQ(3.0, metres.scalar());
+
+  EXPECT_TRUE(audit::report().empty());
+}
+
+TEST(ConversionAudit, FlushesOnThreadExit)
+{
+  audit::reset();
+
+  std::thread(
+      []()
+      {
+        const Feet feet = Inches(24.0);
+        EXPECT_DOUBLE_EQ(2.0, feet.scalar());
+      })
+      .join();
+
+  const auto counts = audit::report();
+  ASSERT_EQ(1U, counts.size());
+  EXPECT_EQ(1U, counts[0].count);
+}
+
+} // End of namespace units.
\ No newline at end of file
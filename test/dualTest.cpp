@@ -0,0 +1,132 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cmath>
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <units/dual.hpp>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+using Dual2 = Dual<double, 2>;
+
+TEST(Dual, Arithmetic)
+{
+  const Dual2 x = Dual2::variable(3.0, 0);
+  const Dual2 y = Dual2::variable(4.0, 1);
+
+  const Dual2 f = x * x * y + 2.0 * y / x - 1.0 / y;
+
+  EXPECT_DOUBLE_EQ(9.0 * 4.0 + 8.0 / 3.0 - 0.25, f.value());
+  EXPECT_DOUBLE_EQ(2.0 * 3.0 * 4.0 - 8.0 / 9.0, f.derivative(0));
+  EXPECT_DOUBLE_EQ(9.0 + 2.0 / 3.0 + 1.0 / 16.0, f.derivative(1));
+
+  const Dual2 g = sqrt(x * x + y * y);
+  EXPECT_DOUBLE_EQ(5.0, g.value());
+  EXPECT_DOUBLE_EQ(0.6, g.derivative(0));
+  EXPECT_DOUBLE_EQ(0.8, g.derivative(1));
+
+  const Dual2 h = exp(log(x)) - sin(y) * cos(y) + pow(x, 3.0);
+  EXPECT_NEAR(1.0 + 27.0, h.derivative(0), 1e-12);
+  EXPECT_NEAR(-std::cos(8.0), h.derivative(1), 1e-12);
+
+  EXPECT_TRUE(x < y);
+  EXPECT_TRUE(Dual2(3.0) == x);
+  EXPECT_DOUBLE_EQ(-1.0, (-x).derivative(0));
+}
+
+TEST(Dual, PowerAtZero)
+{
+  const Dual2 zero = Dual2::variable(0.0, 0);
+
+  EXPECT_EQ(0.0, pow(zero, 2.0).value());
+  EXPECT_EQ(0.0, pow(zero, 2.0).derivative(0));
+  EXPECT_EQ(0.0, pow(zero, 3.5).derivative(0));
+  EXPECT_EQ(1.0, pow(zero, 1.0).derivative(0));
+  EXPECT_EQ(1.0, pow(zero, 0.0).value());
+  EXPECT_EQ(0.0, pow(zero, 0.0).derivative(0));
+  EXPECT_DOUBLE_EQ(12.0, pow(Dual2::variable(2.0, 0), 3.0).derivative(0));
+}
+
+TEST(Dual, ConstantExpressions)
+{
+  constexpr Dual2 x = Dual2::variable(2.0, 1);
+  constexpr Dual2 product = x * x * 3.0;
+
+  static_assert(product.value() == 12.0, "");
+  static_assert(product.derivative(0) == 0.0, "");
+  static_assert(product.derivative(1) == 12.0, "");
+}
+
+TEST(Dual, RepresentationOfQuantities)
+{
+  EXPECT_TRUE((std::is_same<double, RepresentationTraits<Dual2>::Scalar>::value));
+  EXPECT_TRUE((std::is_same<bool, RepresentationTraits<Dual2>::Mask>::value));
+
+  const auto length = seedVariable<2>(Feet(10.0), 0);
+  const AffineQuantity<MetresPhysicalUnit, Dual2> metres = length;
+
+  EXPECT_DOUBLE_EQ(3.048, primal(metres).scalar());
+  EXPECT_DOUBLE_EQ(0.3048, metres.scalar().derivative(0));
+  EXPECT_DOUBLE_EQ(0.3048, (partial<Feet>(metres, 0).scalar()));
+}
+
+TEST(Dual, MixedWithScalarQuantities)
+{
+  // Distance fallen d = g t² / 2, differentiated against both t and g.
+  using Acceleration =
+      DividePhysicalUnits<MetresPhysicalUnit, decltype(Seconds() * Seconds())::PhysicalUnits>;
+  using MetresPerSecondSquared = AffineQuantity<Acceleration::Result, double>;
+
+  const auto time = seedVariable<2>(Seconds(2.0), 0);
+  const auto gravity = seedVariable<2>(MetresPerSecondSquared(9.81), 1);
+
+  auto distance = gravity * time * time;
+  distance *= 0.5;
+
+  EXPECT_TRUE((std::is_same<AffineQuantity<MetresPhysicalUnit, Dual2>, decltype(distance)>::value));
+  EXPECT_DOUBLE_EQ(19.62, primal(distance).scalar());
+
+  const auto speed = partial<Seconds>(distance, 0);
+  EXPECT_TRUE((std::is_same<
+               DividePhysicalUnits<MetresPhysicalUnit, SecondsPhysicalUnit>::Result,
+               decltype(speed)::PhysicalUnits>::value));
+  EXPECT_DOUBLE_EQ(19.62, speed.scalar());
+
+  const auto sensitivity = partial<MetresPerSecondSquared>(distance, 1);
+  EXPECT_TRUE((std::is_same<
+               decltype(Seconds() * Seconds())::PhysicalUnits::PhysicalDimensions,
+               decltype(sensitivity)::PhysicalUnits::PhysicalDimensions>::value));
+  EXPECT_DOUBLE_EQ(2.0, sensitivity.scalar());
+
+  // Scalar quantities on either side of a dual one.
+  const auto area = Metres(2.0) * seedVariable<2>(Metres(3.0), 0);
+  EXPECT_DOUBLE_EQ(2.0, area.scalar().derivative(0));
+  const auto inverse = Metres(6.0) / seedVariable<2>(Metres(3.0), 1);
+  EXPECT_DOUBLE_EQ(-6.0 / 9.0, inverse.scalar().derivative(1));
+}
+
+} // End of namespace units.
\ No newline at end of file
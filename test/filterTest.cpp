@@ -0,0 +1,191 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <units/chrono.hpp>
+#include <units/filter.hpp>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+namespace units
+{
+
+template<typename Column, typename Predicate>
+void expectMask(const std::vector<Column>& column, const BitmaskWord* mask, Predicate predicate)
+{
+  for(std::size_t index = 0; index < column.size(); ++index)
+  {
+    EXPECT_EQ(
+        bool(predicate(column[index])),
+        bool((mask[index / 64U] >> (index % 64U)) & 1U))
+        << index;
+  }
+
+  if(column.size() % 64U != 0U)
+  {
+    EXPECT_EQ(0U, mask[column.size() / 64U] >> (column.size() % 64U));
+  }
+}
+
+template<typename Column>
+void checkPredicates(const std::vector<Column>& column)
+{
+  std::vector<BitmaskWord> mask(bitmaskWords(column.size()));
+
+  filterLess(column.data(), column.size(), Feet(1.0), mask.data());
+  expectMask(column, mask.data(), [](const Column value) { return value < Feet(1.0); });
+
+  filterLessEqual(column.data(), column.size(), Inches(12.0), mask.data());
+  expectMask(column, mask.data(), [](const Column value) { return value <= Inches(12.0); });
+
+  filterGreater(column.data(), column.size(), Metres(0.3048), mask.data());
+  expectMask(column, mask.data(), [](const Column value) { return value > Metres(0.3048); });
+
+  filterGreaterEqual(column.data(), column.size(), Feet(-2.0), mask.data());
+  expectMask(column, mask.data(), [](const Column value) { return value >= Feet(-2.0); });
+
+  filterRange(column.data(), column.size(), Feet(-1.0), Metres(0.5), mask.data());
+  expectMask(
+      column,
+      mask.data(),
+      [](const Column value) { return Feet(-1.0) <= value and value < Metres(0.5); });
+}
+
+TEST(Filter, MatchesScalarOperators)
+{
+  // 203 elements cover full 64-element words and a partial tail.
+  std::vector<Metres> metres;
+  std::vector<Inches> inches;
+  for(int index = -100; index < 103; ++index)
+  {
+    metres.emplace_back(double(index) * 0.0127);
+    inches.emplace_back(double(index) * 0.5);
+  }
+
+  metres[10] = Metres(std::numeric_limits<double>::quiet_NaN());
+
+  checkPredicates(metres);
+  checkPredicates(inches);
+}
+
+TEST(Filter, SinglePrecision)
+{
+  using MetresFloat = AffineQuantity<MetresPhysicalUnit, float>;
+  using FeetFloat = AffineQuantity<FeetPhysicalUnit, float>;
+
+  std::vector<MetresFloat> column;
+  for(int index = -100; index < 103; ++index)
+  {
+    column.emplace_back(float(index) * 0.0127F);
+  }
+
+  std::vector<BitmaskWord> mask(bitmaskWords(column.size()));
+
+  filterGreater(column.data(), column.size(), FeetFloat(1.0F), mask.data());
+  expectMask(column, mask.data(), [](const MetresFloat value) { return value > FeetFloat(1.0F); });
+
+  filterRange(column.data(), column.size(), FeetFloat(-1.0F), MetresFloat(0.5F), mask.data());
+  expectMask(
+      column,
+      mask.data(),
+      [](const MetresFloat value)
+      {
+        return FeetFloat(-1.0F) <= value and value < MetresFloat(0.5F);
+      });
+}
+
+TEST(Filter, IntegralColumnsRoundInexactThresholds)
+{
+  using Nanoseconds = DurationQuantity<std::int64_t, std::nano>;
+  using Microseconds = DurationQuantity<std::int64_t, std::micro>;
+
+  const std::vector<Microseconds> column{
+    Microseconds(1), Microseconds(2), Microseconds(0), Microseconds(-1), Microseconds(-2)
+  };
+  std::vector<BitmaskWord> mask(bitmaskWords(column.size()));
+
+  // Neither 1500 ns nor -1500 ns is a whole number of microseconds.
+  for(const Nanoseconds threshold: { Nanoseconds(1500), Nanoseconds(-1500), Nanoseconds(2000) })
+  {
+    filterLess(column.data(), column.size(), threshold, mask.data());
+    expectMask(column, mask.data(), [=](const Microseconds value) { return value < threshold; });
+
+    filterLessEqual(column.data(), column.size(), threshold, mask.data());
+    expectMask(column, mask.data(), [=](const Microseconds value) { return value <= threshold; });
+
+    filterGreater(column.data(), column.size(), threshold, mask.data());
+    expectMask(column, mask.data(), [=](const Microseconds value) { return value > threshold; });
+
+    filterGreaterEqual(column.data(), column.size(), threshold, mask.data());
+    expectMask(column, mask.data(), [=](const Microseconds value) { return value >= threshold; });
+
+    filterRange(column.data(), column.size(), Nanoseconds(-1500), threshold, mask.data());
+    expectMask(
+        column,
+        mask.data(),
+        [=](const Microseconds value)
+        {
+          return Nanoseconds(-1500) <= value and value < threshold;
+        });
+  }
+
+  filterLess(column.data(), column.size(), Nanoseconds(1500), mask.data());
+  EXPECT_EQ(0x1DU, mask[0]);
+
+  filterGreaterEqual(column.data(), column.size(), Nanoseconds(1500), mask.data());
+  EXPECT_EQ(0x2U, mask[0]);
+}
+
+TEST(Filter, SelectionAndCompaction)
+{
+  std::vector<Metres> column;
+  for(int index = 0; index < 150; ++index)
+  {
+    column.emplace_back(double(index % 10));
+  }
+
+  std::vector<BitmaskWord> mask(bitmaskWords(column.size()));
+  filterGreaterEqual(column.data(), column.size(), Metres(8.0), mask.data());
+
+  ASSERT_EQ(30U, countSelected(mask.data(), column.size()));
+
+  std::vector<std::uint32_t> indices(30U);
+  EXPECT_EQ(30U, selectionVector(mask.data(), column.size(), indices.data()));
+  EXPECT_EQ(8U, indices[0]);
+  EXPECT_EQ(9U, indices[1]);
+  EXPECT_EQ(149U, indices[29]);
+
+  std::vector<std::size_t> wideIndices(30U);
+  EXPECT_EQ(30U, selectionVector(mask.data(), column.size(), wideIndices.data()));
+  EXPECT_EQ(std::vector<std::size_t>(indices.begin(), indices.end()), wideIndices);
+
+  std::vector<Metres> selected(30U);
+  EXPECT_EQ(30U, compact(column.data(), column.size(), mask.data(), selected.data()));
+  EXPECT_EQ(Metres(8.0), selected[0]);
+  EXPECT_EQ(Metres(9.0), selected[29]);
+}
+
+} // End of namespace units.
\ No newline at end of file
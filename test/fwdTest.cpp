@@ -0,0 +1,58 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <units/fwd.hpp>
+
+// Only the forward declarations are visible up to this point. Naming the common aliases in
+// signatures must not require the full definitions.
+namespace units
+{
+
+double lengthInMetres(const Metres& length);
+
+Feet heightOf(const Pounds& mass, const Seconds& duration);
+
+} // End of namespace units.
+
+#include <gtest/gtest.h>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+double lengthInMetres(const Metres& length)
+{
+  return length.scalar();
+}
+
+TEST(ForwardDeclarations, ConsistentWithDefinitions)
+{
+  static_assert(
+      std::is_same<PhysicalDimensions<>, Angle>::value,
+      "Default template arguments of @class PhysicalDimensions are incorrectly declared");
+
+  EXPECT_DOUBLE_EQ(0.0254, lengthInMetres(Inches(1.0)));
+}
+
+} // End of namespace units.
@@ -0,0 +1,221 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <units/histogram.hpp>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+namespace units
+{
+
+using FeetFloat = AffineQuantity<FeetPhysicalUnit, float>;
+using MetresFloat = AffineQuantity<MetresPhysicalUnit, float>;
+
+TEST(Histogram, LinearBoundsAreConvertedAtConstruction)
+{
+  const LinearHistogram<MetresPhysicalUnit> histogram(Feet(0.0), Feet(1000.0), 10U);
+
+  EXPECT_EQ(12U, histogram.bucketCount());
+  EXPECT_DOUBLE_EQ(0.0, histogram.lowerBound(1U).scalar());
+  EXPECT_DOUBLE_EQ(30.48, histogram.lowerBound(2U).scalar());
+  EXPECT_DOUBLE_EQ(304.8, histogram.lowerBound(11U).scalar());
+
+  EXPECT_EQ(1U, histogram.bucket(Metres(0.0)));
+  EXPECT_EQ(1U, histogram.bucket(Metres(30.47)));
+  EXPECT_EQ(2U, histogram.bucket(Feet(100.0) + Feet(1e-9)));
+  EXPECT_EQ(10U, histogram.bucket(Metres(304.7)));
+}
+
+TEST(Histogram, LinearUnderflowAndOverflow)
+{
+  LinearHistogram<MetresPhysicalUnit> histogram(Metres(-1.0), Metres(1.0), 4U);
+
+  histogram.insert(Metres(-1.5));
+  histogram.insert(Metres(-1e300));
+  histogram.insert(Metres(std::numeric_limits<double>::quiet_NaN()));
+  histogram.insert(Metres(1.0));
+  histogram.insert(Metres(std::numeric_limits<double>::infinity()));
+  histogram.insert(Metres(0.25));
+
+  EXPECT_EQ(2U, histogram.count(0U));
+  EXPECT_EQ(1U, histogram.count(3U));
+  EXPECT_EQ(3U, histogram.count(5U));
+}
+
+TEST(Histogram, NaNGoesToOverflowInBothHistograms)
+{
+  const LinearHistogram<MetresPhysicalUnit> linear(Metres(1.0), Metres(8.0), 4U);
+  const LogHistogram<MetresPhysicalUnit> logarithmic(Metres(1.0), Metres(8.0));
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  EXPECT_EQ(linear.bucketCount() - 1U, linear.bucket(Metres(nan)));
+  EXPECT_EQ(linear.bucketCount() - 1U, linear.bucket(Metres(-nan)));
+  EXPECT_EQ(logarithmic.bucketCount() - 1U, logarithmic.bucket(Metres(nan)));
+  EXPECT_EQ(logarithmic.bucketCount() - 1U, logarithmic.bucket(Metres(-nan)));
+
+  const LinearHistogram<MetresPhysicalUnit, float> single(MetresFloat(1.0f), MetresFloat(8.0f), 4U);
+  EXPECT_EQ(
+      single.bucketCount() - 1U,
+      single.bucket(MetresFloat(std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(Histogram, LinearRejectsInvalidBounds)
+{
+  using Histogram = LinearHistogram<MetresPhysicalUnit>;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double infinity = std::numeric_limits<double>::infinity();
+
+  EXPECT_THROW(Histogram(Metres(1.0), Metres(8.0), 0U), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(1.0), Metres(1.0), 4U), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(8.0), Metres(1.0), 4U), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(nan), Metres(8.0), 4U), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(1.0), Metres(nan), 4U), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(-infinity), Metres(8.0), 4U), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(1.0), Metres(infinity), 4U), std::runtime_error);
+  EXPECT_EQ(3U, Histogram(Feet(1.0), Metres(1.0), 1U).bucketCount());
+}
+
+TEST(Histogram, LinearQuantileIsTyped)
+{
+  LinearHistogram<FeetPhysicalUnit, float> histogram(FeetFloat(0.0f), FeetFloat(100.0f), 100U);
+
+  for(int sample = 0; sample < 100; ++sample)
+  {
+    histogram.insert(FeetFloat(float(sample) + 0.5f));
+  }
+
+  EXPECT_TRUE((std::is_same<
+               decltype(histogram.quantile(0.5f)),
+               FeetFloat>::value));
+  EXPECT_NEAR(50.0f, histogram.quantile(0.5f).scalar(), 1e-3f);
+  EXPECT_NEAR(99.0f, histogram.quantile(0.99f).scalar(), 1e-3f);
+  EXPECT_NEAR(100.0f, histogram.quantile(1.0f).scalar(), 1e-3f);
+}
+
+TEST(Histogram, EmptyQuantileIsZero)
+{
+  const LinearHistogram<MetresPhysicalUnit> linear(Metres(1.0), Metres(2.0), 4U);
+  const LogHistogram<MetresPhysicalUnit> logarithmic(Metres(1.0), Metres(2.0));
+
+  EXPECT_EQ(0.0, linear.quantile(0.5).scalar());
+  EXPECT_EQ(0.0, logarithmic.quantile(0.5).scalar());
+}
+
+TEST(Histogram, LogBucketsSplitPowersOfTwo)
+{
+  const LogHistogram<MetresPhysicalUnit, double, 2U> histogram(Metres(1.0), Metres(8.0));
+
+  // Three powers of two of four buckets each, the bucket starting at 8 m, and two outer buckets.
+  EXPECT_EQ(15U, histogram.bucketCount());
+  EXPECT_DOUBLE_EQ(1.0, histogram.lowerBound(1U).scalar());
+  EXPECT_DOUBLE_EQ(1.25, histogram.lowerBound(2U).scalar());
+  EXPECT_DOUBLE_EQ(2.0, histogram.lowerBound(5U).scalar());
+  EXPECT_DOUBLE_EQ(8.0, histogram.lowerBound(13U).scalar());
+
+  EXPECT_EQ(1U, histogram.bucket(Metres(1.0)));
+  EXPECT_EQ(4U, histogram.bucket(Metres(1.99)));
+  EXPECT_EQ(6U, histogram.bucket(Metres(2.5)));
+  EXPECT_EQ(13U, histogram.bucket(Metres(8.0)));
+  EXPECT_EQ(14U, histogram.bucket(Metres(10.0)));
+  EXPECT_EQ(0U, histogram.bucket(Metres(0.5)));
+  EXPECT_EQ(0U, histogram.bucket(Metres(0.0)));
+  EXPECT_EQ(0U, histogram.bucket(Metres(-0.0)));
+  EXPECT_EQ(0U, histogram.bucket(Metres(-4.0)));
+  EXPECT_EQ(14U, histogram.bucket(Metres(std::numeric_limits<double>::infinity())));
+  EXPECT_EQ(0U, histogram.bucket(Metres(-std::numeric_limits<double>::infinity())));
+  EXPECT_EQ(14U, histogram.bucket(Metres(std::numeric_limits<double>::quiet_NaN())));
+  EXPECT_EQ(14U, histogram.bucket(Metres(-std::numeric_limits<double>::quiet_NaN())));
+
+  const LogHistogram<MetresPhysicalUnit, float> single(MetresFloat(1.0f), MetresFloat(8.0f));
+  EXPECT_EQ(
+      single.bucketCount() - 1U,
+      single.bucket(MetresFloat(-std::numeric_limits<float>::quiet_NaN())));
+}
+
+TEST(Histogram, LogRejectsInvalidBounds)
+{
+  using Histogram = LogHistogram<MetresPhysicalUnit>;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double infinity = std::numeric_limits<double>::infinity();
+
+  EXPECT_THROW(Histogram(Metres(0.0), Metres(8.0)), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(-1.0), Metres(8.0)), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(8.0), Metres(1.0)), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(nan), Metres(8.0)), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(1.0), Metres(nan)), std::runtime_error);
+  EXPECT_THROW(Histogram(Metres(1.0), Metres(infinity)), std::runtime_error);
+  EXPECT_EQ(3U, Histogram(Feet(1.0), Feet(1.0)).bucketCount());
+}
+
+TEST(Histogram, LogQuantileRelativeError)
+{
+  LogHistogram<MetresPhysicalUnit, float, 5U> histogram(FeetFloat(0.001f), FeetFloat(1e6f));
+
+  for(int sample = 1; sample <= 10000; ++sample)
+  {
+    histogram.insert(MetresFloat(float(sample)));
+  }
+
+  EXPECT_NEAR(5000.0f, histogram.quantile(0.5f).scalar(), 5000.0f / 32.0f);
+  EXPECT_NEAR(9900.0f, histogram.quantile(0.99f).scalar(), 9900.0f / 32.0f);
+}
+
+TEST(Histogram, ConcurrentInsertionIsMergedOnRead)
+{
+  LinearHistogram<MetresPhysicalUnit, double, 4U> histogram(Metres(0.0), Metres(8.0), 8U);
+  constexpr int kThreads = 6;
+  constexpr int kSamples = 20000;
+
+  std::vector<std::thread> threads;
+
+  for(int thread = 0; thread < kThreads; ++thread)
+  {
+    threads.emplace_back([&histogram]() {
+      for(int sample = 0; sample < kSamples; ++sample)
+      {
+        histogram.insert(Metres(double(sample % 8) + 0.5));
+      }
+    });
+  }
+
+  for(auto& thread: threads)
+  {
+    thread.join();
+  }
+
+  for(std::size_t bucket = 1; bucket <= 8U; ++bucket)
+  {
+    EXPECT_EQ(std::uint64_t(kThreads * kSamples / 8), histogram.count(bucket));
+  }
+
+  EXPECT_EQ(0U, histogram.count(0U));
+  EXPECT_EQ(0U, histogram.count(9U));
+}
+
+} // End of namespace units.
\ No newline at end of file
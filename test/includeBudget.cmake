@@ -0,0 +1,58 @@
+#[[ Measures the include cost of a single public header of units and fails if it exceeds its budget.
+
+    Invoked by ctest as:
+        cmake -DCOMPILER=<c++ compiler> -DINCLUDE_DIR=<include dir> -DHEADER=<units/xyz.hpp>
+              -DWORK_DIR=<scratch dir> -DMAX_BYTES=<budget> -DMAX_MILLISECONDS=<budget>
+              [-DSTANDARD=<c++14 by default>] -P includeBudget.cmake
+
+    The preprocessed size is deterministic for a given standard library and is the primary gate.
+    The parse time (-fsyntax-only) is machine dependent and its budget is therefore generous; it
+    guards against order-of-magnitude regressions such as a heavy standard header sneaking in. ]]
+
+foreach(argument COMPILER INCLUDE_DIR HEADER WORK_DIR MAX_BYTES MAX_MILLISECONDS)
+    if(NOT DEFINED ${argument})
+        message(FATAL_ERROR "includeBudget.cmake requires -D${argument}=<value>.")
+    endif()
+endforeach()
+
+if(NOT DEFINED STANDARD)
+    set(STANDARD c++14)
+endif()
+
+string(MAKE_C_IDENTIFIER "${HEADER}" stem)
+set(source "${WORK_DIR}/${stem}.cpp")
+file(WRITE "${source}" "#include <${HEADER}>\n")
+
+execute_process(
+    COMMAND "${COMPILER}" -std=${STANDARD} -E -P "-I${INCLUDE_DIR}" "${source}"
+    OUTPUT_VARIABLE preprocessed
+    RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to preprocess ${HEADER}.")
+endif()
+
+string(LENGTH "${preprocessed}" bytes)
+
+string(TIMESTAMP start "%s%f")
+execute_process(
+    COMMAND "${COMPILER}" -std=${STANDARD} -fsyntax-only "-I${INCLUDE_DIR}" "${source}"
+    RESULT_VARIABLE result)
+string(TIMESTAMP stop "%s%f")
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to parse ${HEADER}.")
+endif()
+
+math(EXPR milliseconds "(${stop} - ${start}) / 1000")
+
+message(STATUS "${HEADER}: ${bytes} preprocessed bytes (budget ${MAX_BYTES}), "
+               "${milliseconds} ms to parse (budget ${MAX_MILLISECONDS} ms).")
+
+if(bytes GREATER MAX_BYTES)
+    message(FATAL_ERROR "${HEADER} exceeds its preprocessed size budget.")
+endif()
+
+if(milliseconds GREATER MAX_MILLISECONDS)
+    message(FATAL_ERROR "${HEADER} exceeds its parse time budget.")
+endif()
@@ -0,0 +1,62 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <sstream>
+#include <units/imperial.hpp>
+#include <units/io.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+template<typename Quantity>
+std::string toString(const Quantity quantity)
+{
+  std::ostringstream stream;
+  stream << quantity;
+  return stream.str();
+}
+
+TEST(AffineQuantityIO, CoherentUnits)
+{
+  EXPECT_EQ("5 m", toString(Metres(5.0)));
+  EXPECT_EQ("1.5 m s^-1", toString(Metres(3.0) / Seconds(2.0)));
+  EXPECT_EQ("4 m^2 kg", toString(Metres(2.0) * Metres(1.0) * Kilograms(2.0)));
+  EXPECT_EQ("0.5", toString(Radians(0.5)));
+}
+
+TEST(AffineQuantityIO, ScaledUnits)
+{
+  EXPECT_EQ("2 x 127/5000 m", toString(Inches(2.0)));
+  EXPECT_EQ("6 x 381/1250 m^2", toString(Feet(2.0) * Metres(3.0)));
+}
+
+TEST(AffineQuantityIO, FractionalExponents)
+{
+  using RootMetresPhysicalUnit =
+      PhysicalUnits<PhysicalDimensions<std::ratio<1, 2>>, std::ratio<1>>;
+  EXPECT_EQ("3 m^1/2", toString(AffineQuantity<RootMetresPhysicalUnit, double>(3.0)));
+}
+
+} // End of namespace units.
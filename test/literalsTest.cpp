@@ -0,0 +1,65 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <units/literals.hpp>
+
+namespace units
+{
+
+using namespace literals;
+
+TEST(Literals, YieldThePredefinedQuantities)
+{
+  EXPECT_TRUE((std::is_same<Radians, decltype(1.0_rad)>::value));
+  EXPECT_TRUE((std::is_same<Metres, decltype(1.0_m)>::value));
+  EXPECT_TRUE((std::is_same<Kilograms, decltype(1.0_kg)>::value));
+  EXPECT_TRUE((std::is_same<Seconds, decltype(1.0_s)>::value));
+  EXPECT_TRUE((std::is_same<Ampere, decltype(1.0_A)>::value));
+  EXPECT_TRUE((std::is_same<KelvinTemperatureDifference, decltype(1.0_K)>::value));
+  EXPECT_TRUE((std::is_same<Moles, decltype(1.0_mol)>::value));
+  EXPECT_TRUE((std::is_same<Candela, decltype(1.0_cd)>::value));
+  EXPECT_TRUE((std::is_same<Inches, decltype(1.0_in)>::value));
+  EXPECT_TRUE((std::is_same<Feet, decltype(1.0_ft)>::value));
+  EXPECT_TRUE((std::is_same<Pounds, decltype(1.0_lb)>::value));
+}
+
+TEST(Literals, AcceptFloatingPointAndIntegerLiterals)
+{
+  EXPECT_DOUBLE_EQ(9.81, (9.81_m).scalar());
+  EXPECT_DOUBLE_EQ(3.0, (3_ft).scalar());
+  EXPECT_DOUBLE_EQ(12.5, (12.5_kg).scalar());
+  EXPECT_DOUBLE_EQ(0.3048, Metres(1_ft).scalar());
+}
+
+TEST(Literals, AreConstantExpressions)
+{
+  constexpr auto acceleration = 9.81_m / (1_s * 1_s);
+  static_assert(acceleration.scalar() == 9.81, "Literal arithmetic is not constexpr.");
+
+  constexpr Metres length = 2_m + 100_in;
+  EXPECT_DOUBLE_EQ(4.54, length.scalar());
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,66 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <chrono>
+#include <gtest/gtest.h>
+#include <type_traits>
+
+import units;
+
+namespace units
+{
+
+/// Exercises the exported surface through 'import units;' only, so that an entity that is used by
+/// the headers but missing from module/units.cppm fails to compile here.
+TEST(Module, ExportsQuantitiesAndOperators)
+{
+  using namespace units::literals;
+
+  const Metres metres = 1.0_m + Inches(10.0);
+  EXPECT_DOUBLE_EQ(1.254, metres.scalar());
+  EXPECT_TRUE(Metres(0.0254) == Inches(1.0));
+  EXPECT_TRUE(Feet(1.0) < Metres(1.0));
+  EXPECT_DOUBLE_EQ(12.0, quantityCast<Inches>(Feet(1.0)).scalar());
+
+  const auto speed = 3.0_m / 2.0_s;
+  EXPECT_DOUBLE_EQ(1.5, speed.scalar());
+  EXPECT_DOUBLE_EQ(
+      299792458.0,
+      Metres(multiply<PreserveScalePolicy>(constants::kSpeedOfLight, Seconds(1.0))).scalar());
+  EXPECT_DOUBLE_EQ(1500.0, Millimetres(Metres(1.5)).scalar());
+}
+
+TEST(Module, ExportsTheExtensions)
+{
+  EXPECT_EQ(std::chrono::milliseconds(1500), toDuration<std::chrono::milliseconds>(Seconds(1.5)));
+  EXPECT_DOUBLE_EQ(2.0, fromDuration(std::chrono::seconds(2)).scalar());
+
+  const auto side = seedVariable<1>(Metres(3.0), 0U);
+  EXPECT_DOUBLE_EQ(6.0, partial<Metres>(side * side, 0U).scalar());
+  EXPECT_DOUBLE_EQ(6.0, pow(Dual<double, 1>::variable(3.0, 0U), 2.0).derivative(0U));
+
+  EXPECT_TRUE((std::is_same_v<MetresPhysicalUnit, Unit<"m">>));
+  EXPECT_DOUBLE_EQ(19.62, (Kilograms(2.0) * Quantity<"m/s^2">(9.81)).scalar());
+}
+
+} // End of namespace units.
\ No newline at end of file
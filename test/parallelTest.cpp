@@ -0,0 +1,252 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <type_traits>
+#include <units/imperial.hpp>
+#include <units/parallel.hpp>
+#include <units/si.hpp>
+#include <utility>
+#include <vector>
+
+namespace units
+{
+namespace parallel
+{
+
+TEST(Parallel, TransformInfersTheOutputQuantity)
+{
+  ThreadPool pool(4U);
+
+  std::vector<Feet> distances;
+  std::vector<Seconds> durations;
+
+  for(std::size_t index = 0; index < 100000U; ++index)
+  {
+    distances.emplace_back(10.0 * double(index + 1));
+    durations.emplace_back(2.0 * double(index + 1));
+  }
+
+  const auto speeds = transform(
+      pool,
+      [](const Feet d, const Seconds t) { return d / t; },
+      QuantitySpan<const Feet>(distances.data(), distances.size()),
+      QuantitySpan<const Seconds>(durations.data(), durations.size()));
+
+  static_assert(
+      std::is_same<
+          const Buffer<std::decay_t<decltype(Feet(1.0) / Seconds(1.0))>>,
+          decltype(speeds)>::value,
+      "The output quantity is the result of the function.");
+
+  ASSERT_EQ(distances.size(), speeds.size());
+
+  for(std::size_t index = 0; index < speeds.size(); ++index)
+  {
+    ASSERT_DOUBLE_EQ(5.0, speeds[index].scalar());
+  }
+}
+
+TEST(Parallel, TransformWritesIntoAnOutputSpan)
+{
+  ThreadPool pool(3U);
+
+  std::vector<Feet> feet;
+  for(std::size_t index = 0; index < 50001U; ++index)
+  {
+    feet.emplace_back(double(index));
+  }
+
+  std::vector<Metres> metres(feet.size());
+  transform(
+      pool,
+      QuantitySpan<Metres>(metres.data(), metres.size()),
+      [](const Feet d) { return quantityCast<Metres>(d); },
+      QuantitySpan<const Feet>(feet.data(), feet.size()));
+
+  for(std::size_t index = 0; index < metres.size(); ++index)
+  {
+    ASSERT_DOUBLE_EQ(0.3048 * double(index), metres[index].scalar());
+  }
+}
+
+TEST(Parallel, SingleThreadRunsOnTheCaller)
+{
+  ThreadPool pool(1U);
+  EXPECT_EQ(1U, pool.size());
+
+  const auto caller = std::this_thread::get_id();
+  bool inline_ = true;
+
+  auto chunk = [&](const std::size_t) {
+    inline_ = inline_ && std::this_thread::get_id() == caller;
+  };
+  pool.run(100U, chunk);
+
+  EXPECT_TRUE(inline_);
+
+  const std::vector<Metres> input(10U, Metres(2.0));
+  const auto output = transform(
+      pool,
+      [](const Metres d) { return d * d; },
+      QuantitySpan<const Metres>(input.data(), input.size()));
+
+  ASSERT_EQ(10U, output.size());
+  EXPECT_DOUBLE_EQ(4.0, output[9U].scalar());
+}
+
+TEST(Parallel, EveryChunkRunsOnceAndIdleWorkersSteal)
+{
+  constexpr std::size_t kChunks = 64U;
+
+  ThreadPool pool(4U);
+  std::vector<std::atomic<int>> calls(kChunks);
+  std::vector<std::thread::id> threads(kChunks);
+  const auto caller = std::this_thread::get_id();
+
+  auto chunk = [&](const std::size_t index) {
+    if(index < kChunks / 4U)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    threads[index] = std::this_thread::get_id();
+    calls[index].fetch_add(1);
+  };
+
+  pool.run(kChunks, chunk);
+
+  std::size_t stolen = 0;
+  for(std::size_t index = 0; index < kChunks; ++index)
+  {
+    EXPECT_EQ(1, calls[index].load());
+    stolen += index < kChunks / 4U && threads[index] != caller ? 1U : 0U;
+  }
+
+  EXPECT_LT(0U, stolen);
+}
+
+TEST(Parallel, BuffersAndTransformsStartWorkersOnTheSameShares)
+{
+  constexpr std::size_t kWorkers = 4U;
+  constexpr std::size_t kSize = 20000U;
+
+  // A Buffer of doubles and a transform of one double column into another cut different chunks.
+  const detail::ChunkPlan buffer(
+      kWorkers, kSize, sizeof(double), detail::chunkElements(sizeof(double), sizeof(double)));
+  const detail::ChunkPlan transform(
+      kWorkers, kSize, sizeof(double), detail::chunkElements(2U * sizeof(double), sizeof(double)));
+  ASSERT_NE(buffer.chunks(), transform.chunks());
+
+  auto share = [](const detail::ChunkPlan& plan, const std::size_t worker) {
+    const std::size_t first = worker * plan.chunks() / kWorkers;
+    const std::size_t last = (worker + 1U) * plan.chunks() / kWorkers;
+
+    for(std::size_t chunk = first; chunk + 1U < last; ++chunk)
+    {
+      EXPECT_EQ(plan.end(chunk), plan.begin(chunk + 1U));
+    }
+
+    return std::make_pair(plan.begin(first), plan.end(last - 1U));
+  };
+
+  for(std::size_t worker = 0; worker < kWorkers; ++worker)
+  {
+    EXPECT_EQ(share(buffer, worker), share(transform, worker)) << worker;
+    EXPECT_EQ(worker * kSize / kWorkers, share(buffer, worker).first);
+  }
+
+  EXPECT_EQ(kSize, share(buffer, kWorkers - 1U).second);
+
+  // Small ranges engage fewer workers, but the same ones for every pass.
+  const detail::ChunkPlan small(kWorkers, 3000U, sizeof(double), 64U);
+  EXPECT_EQ(2U, small.engaged());
+  EXPECT_EQ(1496U, small.begin(small.chunks() / kWorkers));
+  EXPECT_EQ(3000U, small.begin(small.chunks() / 2U));
+  EXPECT_EQ(3000U, small.end(small.chunks() - 1U));
+}
+
+TEST(Parallel, ConcurrentRunsAreSerialised)
+{
+  constexpr std::size_t kChunks = 256U;
+
+  ThreadPool pool(4U);
+  std::vector<std::atomic<int>> calls(2U * kChunks);
+
+  auto runFrom = [&](const std::size_t first) {
+    auto chunk = [&calls, first](const std::size_t index) { calls[first + index].fetch_add(1); };
+
+    for(int pass = 0; pass < 20; ++pass)
+    {
+      pool.run(kChunks, chunk);
+    }
+  };
+
+  std::thread other(runFrom, kChunks);
+  runFrom(0U);
+  other.join();
+
+  for(std::size_t index = 0; index < calls.size(); ++index)
+  {
+    ASSERT_EQ(20, calls[index].load()) << index;
+  }
+}
+
+TEST(Parallel, PoolIsReusableAndHandlesEmptyRanges)
+{
+  ThreadPool pool(4U);
+
+  const std::vector<Metres> empty;
+  const auto nothing = transform(
+      pool,
+      [](const Metres d) { return d; },
+      QuantitySpan<const Metres>(empty.data(), empty.size()));
+  EXPECT_EQ(0U, nothing.size());
+
+  const Buffer<Metres> zeros(pool, 20000U);
+  for(std::size_t index = 0; index < zeros.size(); ++index)
+  {
+    ASSERT_EQ(0.0, zeros[index].scalar());
+  }
+
+  std::vector<Metres> values(20000U, Metres(1.0));
+  for(int pass = 0; pass < 50; ++pass)
+  {
+    transform(
+        pool,
+        QuantitySpan<Metres>(values.data(), values.size()),
+        [](const Metres d) { return d + Metres(1.0); },
+        QuantitySpan<const Metres>(values.data(), values.size()));
+  }
+
+  for(const auto& value: values)
+  {
+    ASSERT_DOUBLE_EQ(51.0, value.scalar());
+  }
+}
+
+} // End of namespace parallel.
+} // End of namespace units.
\ No newline at end of file
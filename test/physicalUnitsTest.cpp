@@ -116,6 +116,22 @@ TEST(MultiplyPhysicalUnits, StaticChecks)
       "MultiplyPhysicalUnits");
 }
 
+TEST(MultiplyPhysicalUnits, CanonicalScalePolicy)
+{
+  using Multiplication =
+      MultiplyPhysicalUnits<MetresPhysicalUnit, PoundsPhysicalUnit, CanonicalScalePolicy>;
+
+  static_assert(
+      std::is_same<std::ratio<45359237, 100000000>, typename Multiplication::ExactResult::Scale>::
+          value,
+      "Exact scale of the resulting physical unit is incorrectly computed in @class "
+      "MultiplyPhysicalUnits");
+
+  static_assert(
+      std::is_same<std::ratio<1>, typename Multiplication::Result::Scale>::value,
+      "Scale of the resulting physical unit is not normalised by @class CanonicalScalePolicy");
+}
+
 TEST(DividePhysicalUnits, StaticChecks)
 {
   using DivideMeterPoundsUnits = DividePhysicalUnits<MetresPhysicalUnit, PoundsPhysicalUnit>;
@@ -147,4 +163,19 @@ TEST(DividePhysicalUnits, StaticChecks)
       "Scale of the resulting physical unit is incorrectly computed in @class DividePhysicalUnits");
 }
 
+TEST(DividePhysicalUnits, CanonicalScalePolicy)
+{
+  using Division =
+      DividePhysicalUnits<MetresPhysicalUnit, PoundsPhysicalUnit, CanonicalScalePolicy>;
+
+  static_assert(
+      std::is_same<std::ratio<100000000, 45359237>, typename Division::ExactResult::Scale>::value,
+      "Exact scale of the resulting physical unit is incorrectly computed in @class "
+      "DividePhysicalUnits");
+
+  static_assert(
+      std::is_same<std::ratio<1>, typename Division::Result::Scale>::value,
+      "Scale of the resulting physical unit is not normalised by @class CanonicalScalePolicy");
+}
+
 } // End of namespace units.
@@ -0,0 +1,162 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <new>
+#include <units/imperial.hpp>
+#include <units/pmr.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+namespace pmr
+{
+
+TEST(BumpArena, ServesAlignedAllocationsFromItsBuffer)
+{
+  BumpArena arena(1024U);
+
+  void* const first = arena.allocate(3U, 1U);
+  void* const second = arena.allocate(sizeof(double), alignof(double));
+
+  EXPECT_EQ(0U, reinterpret_cast<std::uintptr_t>(second) % alignof(double));
+  EXPECT_LT(first, second);
+  EXPECT_LE(3U + sizeof(double), arena.used());
+  EXPECT_EQ(1024U, arena.capacity());
+  EXPECT_EQ(0U, arena.overflowCount());
+
+  arena.reset();
+  EXPECT_EQ(0U, arena.used());
+  EXPECT_EQ(first, arena.allocate(3U, 1U));
+}
+
+TEST(BumpArena, FallsBackToUpstreamWhenExhausted)
+{
+  BumpArena arena(64U);
+
+  QuantityVector<Metres> lengths(&arena);
+  lengths.reserve(4U);
+  EXPECT_EQ(0U, arena.overflowCount());
+
+  lengths.reserve(64U);
+  EXPECT_EQ(1U, arena.overflowCount());
+
+  lengths.clear();
+  lengths.shrink_to_fit();
+  arena.reset();
+  EXPECT_EQ(0U, arena.overflowCount());
+}
+
+/// Upstream resource that fails its @param failing-th allocation and counts live ones.
+class FailingResource: public std::pmr::memory_resource
+{
+public:
+  explicit FailingResource(const int failing): mFailing(failing) {}
+
+  int live() const noexcept(true)
+  {
+    return mLive;
+  }
+
+private:
+  void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+  {
+    if(--mFailing == 0)
+    {
+      throw std::bad_alloc();
+    }
+
+    ++mLive;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* const pointer, const std::size_t bytes, const std::size_t alignment)
+      override
+  {
+    --mLive;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override
+  {
+    return this == &rhs;
+  }
+
+  int mFailing;
+  int mLive = 0;
+};
+
+TEST(BumpArena, ReleasesTheOverflowBlockIfItCannotBeTracked)
+{
+  // The buffer and the overflow block succeed; growing the list of overflow blocks fails.
+  FailingResource upstream(3);
+
+  {
+    BumpArena arena(64U, &upstream);
+    EXPECT_THROW(static_cast<void>(arena.allocate(128U, alignof(double))), std::bad_alloc);
+    EXPECT_EQ(0U, arena.overflowCount());
+    EXPECT_EQ(1, upstream.live());
+  }
+
+  EXPECT_EQ(0, upstream.live());
+}
+
+TEST(BulkOperations, AllocateFromTheResourceOfTheInput)
+{
+  BumpArena arena(4096U);
+
+  QuantityVector<Feet> distances(&arena);
+  QuantityVector<Seconds> durations(&arena);
+
+  for(int index = 1; index <= 8; ++index)
+  {
+    distances.emplace_back(10.0 * index);
+    durations.emplace_back(2.0 * index);
+  }
+
+  const auto usedByInputs = arena.used();
+
+  const auto metres = convert<Metres>(distances);
+  const auto speeds =
+      transform(distances, durations, [](const Feet d, const Seconds t) { return d / t; });
+  const auto doubled = transform(metres, [](const Metres d) { return d + d; });
+
+  EXPECT_EQ(&arena, metres.get_allocator().resource());
+  EXPECT_EQ(&arena, speeds.get_allocator().resource());
+  EXPECT_EQ(&arena, doubled.get_allocator().resource());
+  EXPECT_LT(usedByInputs, arena.used());
+  EXPECT_EQ(0U, arena.overflowCount());
+
+  ASSERT_EQ(distances.size(), metres.size());
+  ASSERT_EQ(distances.size(), speeds.size());
+
+  for(std::size_t index = 0; index < distances.size(); ++index)
+  {
+    EXPECT_DOUBLE_EQ(3.048 * double(index + 1), metres[index].scalar());
+    EXPECT_DOUBLE_EQ(5.0, speeds[index].scalar());
+    EXPECT_DOUBLE_EQ(2.0 * metres[index].scalar(), doubled[index].scalar());
+  }
+}
+
+} // End of namespace pmr.
+} // End of namespace units.
\ No newline at end of file
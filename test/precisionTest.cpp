@@ -0,0 +1,129 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cmath>
+#include <gtest/gtest.h>
+#include <units/angle.hpp>
+#include <units/imperial.hpp>
+#include <units/precision.hpp>
+#include <units/prefixes.hpp>
+
+namespace units
+{
+
+TEST(Precision, FastMatchesTheImplicitConversion)
+{
+  for(double value = -10.0; value < 10.0; value += 0.37)
+  {
+    EXPECT_EQ(
+        Metres(Inches(value)).scalar(),
+        (quantityCast<Metres, FastPrecision>(Inches(value)).scalar()));
+  }
+
+  static_assert(quantityCast<Metres, FastPrecision>(Decimetres(3.0)).scalar() == 3.0 * 0.1, "");
+}
+
+TEST(Precision, ExactRatioIsExactForIntegralInputs)
+{
+  EXPECT_NE(0.3, (quantityCast<Metres, FastPrecision>(Decimetres(3.0)).scalar()));
+  EXPECT_EQ(0.3, (quantityCast<Metres, ExactRatioPrecision>(Decimetres(3.0)).scalar()));
+  EXPECT_EQ(0.3, (quantityCast<Metres, DoubleDoublePrecision>(Decimetres(3.0)).scalar()));
+
+  static_assert(
+      quantityCast<Metres, ExactRatioPrecision>(Decimetres(3.0)).scalar() == 0.3,
+      "The two-step conversion is usable in constant expressions.");
+
+  // Every integral count of millimetres up to a million converts to the correctly rounded metres.
+  for(int count = 0; count <= 1000000; count += 7)
+  {
+    ASSERT_EQ(
+        double(count) / 1000.0,
+        (quantityCast<Metres, ExactRatioPrecision>(Millimetres(double(count))).scalar()));
+  }
+}
+
+TEST(Precision, DoubleDoubleIsCorrectlyRounded)
+{
+  // Reference: inches to metres is 127 / 5000 exactly; x * 127 is exact for these x, so the
+  // correctly rounded result is fl(x * 127) / 5000.
+  int fastMismatches = 0;
+
+  for(int step = 1; step < 100000; ++step)
+  {
+    const double value = double(step) * 0.125;
+    const double reference = value * 127.0 / 5000.0;
+
+    ASSERT_EQ(reference, (quantityCast<Metres, DoubleDoublePrecision>(Inches(value)).scalar()));
+    fastMismatches += (quantityCast<Metres, FastPrecision>(Inches(value)).scalar() != reference);
+  }
+
+  EXPECT_GT(fastMismatches, 0);
+}
+
+TEST(Precision, ScaleSplitsIntoHighAndLow)
+{
+  using Scale = detail::DoubleDoubleScale<std::ratio<1, 10>, double>;
+  const double high = Scale::kHigh;
+  const double low = Scale::kLow;
+
+  // fl(1/10) exceeds 1/10 by 2^-55 / 5, which the low part recovers to within its own rounding.
+  EXPECT_EQ(0.1, high);
+  EXPECT_DOUBLE_EQ(-std::ldexp(1.0, -55) / 5.0, low);
+}
+
+TEST(Precision, FactoredAndFloatScales)
+{
+  const double fast = quantityCast<Metres, FastPrecision>(Yoctometres(3e24)).scalar();
+  const double exact = quantityCast<Metres, ExactRatioPrecision>(Yoctometres(3e24)).scalar();
+  const double doubleDouble =
+      quantityCast<Metres, DoubleDoublePrecision>(Yoctometres(3e24)).scalar();
+
+  EXPECT_DOUBLE_EQ(3.0, fast);
+  EXPECT_DOUBLE_EQ(3.0, exact);
+  EXPECT_DOUBLE_EQ(3.0, doubleDouble);
+
+  using FloatInches = AffineQuantity<InchesPhysicalUnit, float>;
+  using FloatMetres = AffineQuantity<MetresPhysicalUnit, float>;
+
+  for(int step = 1; step < 1000; ++step)
+  {
+    const float value = float(step);
+    const float reference = float(double(step) * 0.0254);
+
+    ASSERT_EQ(
+        reference,
+        (quantityCast<FloatMetres, DoubleDoublePrecision>(FloatInches(value)).scalar()));
+    ASSERT_EQ(
+        reference,
+        (quantityCast<FloatMetres, ExactRatioPrecision>(FloatInches(value)).scalar()));
+  }
+}
+
+TEST(Precision, IdentityIsUntouched)
+{
+  EXPECT_EQ(0.1, (quantityCast<Metres, ExactRatioPrecision>(Metres(0.1)).scalar()));
+  EXPECT_EQ(0.1, (quantityCast<Metres, DoubleDoublePrecision>(Metres(0.1)).scalar()));
+  EXPECT_EQ(0.1, (quantityCast<Metres, DoubleDoublePrecision>(Kilo<Millimetres>(0.1)).scalar()));
+}
+
+} // End of namespace units.
\ No newline at end of file
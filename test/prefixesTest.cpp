@@ -0,0 +1,107 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <ratio>
+#include <type_traits>
+#include <units/imperial.hpp>
+#include <units/prefixes.hpp>
+
+namespace units
+{
+
+/// Representation that cannot be multiplied. Converting it only compiles if the multiply is
+/// elided.
+struct Unscalable
+{
+  double mValue;
+};
+
+TEST(Prefixes, PrefixesFoldIntoTheScale)
+{
+  EXPECT_TRUE((std::is_same<PhysicalUnits<Length, std::kilo>, KilometresPhysicalUnit>::value));
+  EXPECT_TRUE(
+      (std::is_same<AffineQuantity<PhysicalUnits<Time, std::milli>, double>, Milliseconds>::value));
+  EXPECT_TRUE((std::is_same<PhysicalUnits<Mass, std::micro>, Milli<GramsPhysicalUnit>>::value));
+  EXPECT_TRUE((std::is_same<Kilograms, Kilo<Grams>>::value));
+
+  EXPECT_TRUE((std::is_same<
+               PhysicalUnits<Length, std::ratio<381, 1250000>>,
+               Milli<FeetPhysicalUnit>>::value));
+}
+
+TEST(Prefixes, ChainsCollapseToASingleScale)
+{
+  EXPECT_TRUE((std::is_same<MetresPhysicalUnit, Kilo<Milli<MetresPhysicalUnit>>>::value));
+  EXPECT_TRUE((std::is_same<MegametresPhysicalUnit, Kilo<Kilo<MetresPhysicalUnit>>>::value));
+  EXPECT_TRUE((std::is_same<Nanoseconds, Milli<Micro<Seconds>>>::value));
+  EXPECT_TRUE((std::is_same<Seconds, Quetta<Quecto<Seconds>>>::value));
+}
+
+TEST(Prefixes, ExtremePrefixesAreFactored)
+{
+  EXPECT_TRUE((std::is_same<
+               FactoredScale<PrimePower<2, 24>, PrimePower<5, 24>>,
+               YottametresPhysicalUnit::Scale>::value));
+  EXPECT_TRUE((std::is_same<std::micro, Yocto<ZettagramsPhysicalUnit>::Scale>::value));
+
+  EXPECT_DOUBLE_EQ(1e-6, Metres(Yoctometres(1e18)).scalar());
+}
+
+TEST(Prefixes, CompoundUnitsConvertInOneMultiply)
+{
+  using KilometresPerHour = DividePhysicalUnits<
+      KilometresPhysicalUnit,
+      Kilo<Milli<PhysicalUnits<Time, std::ratio<3600>>>>,
+      PreserveScalePolicy>::Result;
+  using MillimetresPerSecond =
+      DividePhysicalUnits<MillimetresPhysicalUnit, SecondsPhysicalUnit, PreserveScalePolicy>::
+          Result;
+
+  EXPECT_TRUE((std::is_same<std::ratio<5, 18>, KilometresPerHour::Scale>::value));
+
+  using Scale = PhysicalUnitsScale<MillimetresPerSecond, KilometresPerHour, double>;
+  EXPECT_TRUE((std::is_same<std::ratio<2500, 9>, Scale::Result>::value));
+
+  using Hours = AffineQuantity<PhysicalUnits<Time, std::ratio<3600>>, double>;
+  using MetresPerSecond = AffineQuantity<
+      DividePhysicalUnits<MetresPhysicalUnit, SecondsPhysicalUnit>::Result,
+      double>;
+
+  const auto speed = divide<PreserveScalePolicy>(Kilometres(36.0), Hours(1.0));
+  EXPECT_TRUE((std::is_same<KilometresPerHour, decltype(speed)::PhysicalUnits>::value));
+  EXPECT_DOUBLE_EQ(10.0, MetresPerSecond(speed).scalar());
+}
+
+TEST(Prefixes, IdentityConversionsAreElided)
+{
+  using KiloMilliMetres = PhysicalUnits<Length, std::ratio<1000, 1000>>;
+
+  constexpr Unscalable value =
+      detail::rescale<MetresPhysicalUnit, KiloMilliMetres>(Unscalable{ 2.5 });
+  EXPECT_EQ(2.5, value.mValue);
+
+  EXPECT_EQ(4.0, (Metres(AffineQuantity<KiloMilliMetres, double>(4.0)).scalar()));
+}
+
+} // End of namespace units.
\ No newline at end of file
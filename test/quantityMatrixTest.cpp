@@ -0,0 +1,161 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <units/imperial.hpp>
+#include <units/quantityMatrix.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+using MetresPerSecondPhysicalUnit =
+    typename DividePhysicalUnits<MetresPhysicalUnit, SecondsPhysicalUnit>::Result;
+
+using PositionVelocity = PhysicalUnitsList<MetresPhysicalUnit, MetresPerSecondPhysicalUnit>;
+
+using Position = PhysicalUnitsList<MetresPhysicalUnit>;
+
+TEST(QuantityMatrix, StaticChecks)
+{
+  using Covariance = CovarianceMatrix<double, PositionVelocity>;
+
+  static_assert(
+      std::is_same<
+          typename Covariance::Entry<0, 1>::PhysicalUnits::PhysicalDimensions,
+          typename DividePhysicalDimensions<Area, Time>::Result>::value,
+      "Entry units are incorrectly computed for @class CovarianceMatrix");
+
+  using Jacobian = JacobianMatrix<double, Position, PositionVelocity>;
+
+  static_assert(
+      std::is_same<
+          typename Jacobian::Entry<0, 1>::PhysicalUnits::PhysicalDimensions,
+          Time>::value,
+      "Entry units are incorrectly computed for @class JacobianMatrix");
+
+  static_assert(
+      std::is_same<
+          CovarianceMatrix<double, Position>,
+          decltype(Jacobian() * Covariance() * Jacobian().transpose())>::value,
+      "Covariance propagation is required to yield the covariance of the output");
+
+  static_assert(
+      alignof(Covariance) >= 64, "@class QuantityMatrix is required to be aligned for SIMD");
+}
+
+TEST(StateVector, Accessors)
+{
+  StateVector<double, PhysicalUnitsList<MetresPhysicalUnit, RadiansPhysicalUnit>> state;
+  state.set<0>(Feet(1.0));
+  state.set<1>(Radians(0.5));
+
+  EXPECT_DOUBLE_EQ(0.3048, state.get<0>().scalar());
+  EXPECT_DOUBLE_EQ(0.5, state.get<1>().scalar());
+
+  state += state;
+  EXPECT_DOUBLE_EQ(0.6096, state.get<0>().scalar());
+  EXPECT_DOUBLE_EQ(0.0, (state - state).get<1>().scalar());
+}
+
+TEST(QuantityMatrix, EquivalentScalesCancel)
+{
+  // Inches and the reciprocal of the reciprocal of inches are distinct types of identical scale.
+  using InchesList = PhysicalUnitsList<InchesPhysicalUnit>;
+
+  StateVector<double, InchesList> input;
+  input.set<0>(Inches(2.0));
+
+  JacobianMatrix<double, Position, InchesList> jacobian;
+  jacobian.set<0, 0>(Metres(3.0) / Inches(1.0));
+
+  EXPECT_DOUBLE_EQ(6.0, (jacobian * input).get<0>().scalar());
+}
+
+TEST(QuantityMatrix, KalmanFilter)
+{
+  using Velocity = AffineQuantity<MetresPerSecondPhysicalUnit, double>;
+
+  // Constant velocity model observed through its position.
+  StateVector<double, PositionVelocity> state;
+  state.set<1>(Velocity(1.0));
+
+  CovarianceMatrix<double, PositionVelocity> covariance;
+  covariance.set<0, 0>(Metres(1.0) * Metres(1.0));
+  covariance.set<1, 1>(Velocity(1.0) * Velocity(1.0));
+
+  auto transition = JacobianMatrix<double, PositionVelocity, PositionVelocity>::identity();
+  transition.set<0, 1>(Seconds(2.0));
+
+  const JacobianMatrix<double, PositionVelocity, PositionVelocity> transitionCopy = transition;
+  state = transitionCopy * state;
+  covariance = transition * covariance * transition.transpose();
+
+  EXPECT_DOUBLE_EQ(2.0, state.get<0>().scalar());
+  EXPECT_DOUBLE_EQ(5.0, (covariance.get<0, 0>().scalar()));
+  EXPECT_DOUBLE_EQ(2.0, (covariance.get<0, 1>().scalar()));
+
+  JacobianMatrix<double, Position, PositionVelocity> observation;
+  observation.set<0, 0>(Metres(1.0) / Metres(1.0));
+
+  CovarianceMatrix<double, Position> noise;
+  noise.set<0, 0>(Metres(1.0) * Metres(1.0));
+
+  StateVector<double, Position> measurement;
+  measurement.set<0>(Metres(3.0));
+
+  const auto innovation = observation * covariance * observation.transpose() + noise;
+  const auto gain = covariance * observation.transpose() * innovation.inverse();
+
+  static_assert(
+      std::is_same<const JacobianMatrix<double, PositionVelocity, Position>, decltype(gain)>::value,
+      "The Kalman gain is required to map measurements onto the state");
+
+  state += gain * (measurement - observation * state);
+  covariance = (decltype(gain * observation)::identity() - gain * observation) * covariance;
+
+  EXPECT_DOUBLE_EQ(2.0 + 5.0 / 6.0, state.get<0>().scalar());
+  EXPECT_DOUBLE_EQ(1.0 + 2.0 / 6.0, state.get<1>().scalar());
+  EXPECT_DOUBLE_EQ(5.0 / 6.0, (covariance.get<0, 0>().scalar()));
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, (covariance.get<1, 1>().scalar()));
+}
+
+TEST(QuantityMatrix, Inverse)
+{
+  using Planar = PhysicalUnitsList<MetresPhysicalUnit, RadiansPhysicalUnit>;
+
+  CovarianceMatrix<double, Planar> covariance;
+  covariance.data()[0] = 0.0;
+  covariance.data()[1] = 2.0;
+  covariance.data()[2] = 4.0;
+  covariance.data()[3] = 1.0;
+
+  const auto product = covariance * covariance.inverse();
+
+  EXPECT_DOUBLE_EQ(1.0, product.data()[0]);
+  EXPECT_DOUBLE_EQ(0.0, product.data()[1]);
+  EXPECT_DOUBLE_EQ(0.0, product.data()[2]);
+  EXPECT_DOUBLE_EQ(1.0, product.data()[3]);
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,185 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <units/imperial.hpp>
+#include <units/quantized.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+namespace units
+{
+
+/// Length in counts of 0.1 mm.
+using TenthMillimetres = QuantizedQuantity<MetresPhysicalUnit, std::int16_t, std::ratio<1, 10000>>;
+
+TEST(QuantizedQuantity, StaticChecks)
+{
+  static_assert(
+      sizeof(TenthMillimetres) == sizeof(std::int16_t),
+      "A quantized quantity is required to be as small as its storage");
+
+  static_assert(
+      std::is_same<
+          std::ratio<1, 10000>,
+          typename TenthMillimetres::LSBPhysicalUnits::Scale>::value,
+      "The LSB is required to be folded into the scale of a count");
+
+  static_assert(
+      TenthMillimetres::quantize(Metres(0.5)).count() == 5000,
+      "Quantization is required to be constexpr");
+}
+
+TEST(QuantizedQuantity, RoundTrip)
+{
+  const auto quantized = TenthMillimetres::quantize(Inches(1.0));
+  EXPECT_EQ(254, quantized.count());
+  EXPECT_DOUBLE_EQ(0.0254, quantized.dequantize<Metres>().scalar());
+  EXPECT_DOUBLE_EQ(1.0, quantized.dequantize<Inches>().scalar());
+
+  EXPECT_EQ(3, TenthMillimetres::quantize(Metres(0.00025)).count());
+  EXPECT_EQ(-3, TenthMillimetres::quantize(Metres(-0.00025)).count());
+  EXPECT_EQ(2, TenthMillimetres::quantize(Metres(0.00024)).count());
+}
+
+TEST(QuantizedQuantity, Saturation)
+{
+  EXPECT_EQ(32767, TenthMillimetres::quantize(Metres(4.0)).count());
+  EXPECT_EQ(-32768, TenthMillimetres::quantize(Metres(-4.0)).count());
+  EXPECT_EQ(0, TenthMillimetres::quantize(Metres(std::nan(""))).count());
+
+  using Counts = QuantizedQuantity<MetresPhysicalUnit, std::uint8_t, std::ratio<1>>;
+  EXPECT_EQ(0, Counts::quantize(Metres(-1.0)).count());
+  EXPECT_EQ(255, Counts::quantize(Metres(300.0)).count());
+}
+
+TEST(QuantizedQuantity, BulkMatchesScalar)
+{
+  using MetresFloat = AffineQuantity<MetresPhysicalUnit, float>;
+
+  // An odd size exercises both the vectorized body and the scalar tail.
+  std::vector<MetresFloat> input;
+  for(int index = -500; index < 501; ++index)
+  {
+    input.emplace_back(float(index) * 0.0123F);
+  }
+
+  input[7] = MetresFloat(std::numeric_limits<float>::quiet_NaN());
+  input[8] = MetresFloat(-std::numeric_limits<float>::infinity());
+
+  std::vector<TenthMillimetres> quantized(input.size());
+  quantize(input.data(), input.size(), quantized.data());
+
+  std::vector<MetresFloat> dequantizedFloat(input.size());
+  dequantize(quantized.data(), quantized.size(), dequantizedFloat.data());
+
+  std::vector<Inches> dequantizedInches(input.size());
+  dequantize(quantized.data(), quantized.size(), dequantizedInches.data());
+
+  for(std::size_t index = 0; index < input.size(); ++index)
+  {
+    const auto expected = TenthMillimetres::quantize(input[index]);
+    ASSERT_EQ(expected.count(), quantized[index].count()) << index;
+
+    EXPECT_EQ(
+        expected.dequantize<MetresFloat>().scalar(),
+        dequantizedFloat[index].scalar());
+
+    EXPECT_EQ(expected.dequantize<Inches>().scalar(), dequantizedInches[index].scalar());
+  }
+}
+
+/// Quantizes @param input in bulk and back, and compares every element to the scalar path.
+template<typename Quantized, typename Quantity>
+void expectBulkMatchesScalar(std::vector<Quantity> input)
+{
+  using FloatType = typename Quantity::FloatType;
+
+  input[7] = Quantity(std::numeric_limits<FloatType>::quiet_NaN());
+  input[8] = Quantity(-std::numeric_limits<FloatType>::infinity());
+  input[9] = Quantity(std::numeric_limits<FloatType>::infinity());
+  input[10] = Quantity(-std::numeric_limits<FloatType>::quiet_NaN());
+
+  std::vector<Quantized> quantized(input.size());
+  quantize(input.data(), input.size(), quantized.data());
+
+  std::vector<Quantity> dequantized(input.size());
+  dequantize(quantized.data(), quantized.size(), dequantized.data());
+
+  for(std::size_t index = 0; index < input.size(); ++index)
+  {
+    const auto expected = Quantized::quantize(input[index]);
+    ASSERT_EQ(expected.count(), quantized[index].count()) << index;
+    EXPECT_EQ(expected.template dequantize<Quantity>().scalar(), dequantized[index].scalar());
+  }
+}
+
+/// Odd-sized ramp of @param step around 0, with exact halves of an LSB of @param lsb.
+template<typename Quantity>
+std::vector<Quantity> ramp(const double step, const double lsb)
+{
+  using FloatType = typename Quantity::FloatType;
+
+  std::vector<Quantity> values;
+  for(int index = -500; index < 501; ++index)
+  {
+    values.emplace_back(FloatType(double(index) * step));
+  }
+
+  for(int index = -20; index < 21; ++index)
+  {
+    values.emplace_back(FloatType((double(index) + 0.5) * lsb));
+  }
+
+  return values;
+}
+
+TEST(QuantizedQuantity, BulkMatchesScalarForEveryKernel)
+{
+  using MetresFloat = AffineQuantity<MetresPhysicalUnit, float>;
+  using Micrometres = QuantizedQuantity<MetresPhysicalUnit, std::int32_t, std::micro>;
+
+  expectBulkMatchesScalar<TenthMillimetres>(ramp<Metres>(0.0123, 1e-4));
+  expectBulkMatchesScalar<Micrometres>(ramp<MetresFloat>(5.0, 1e-6));
+  expectBulkMatchesScalar<Micrometres>(ramp<Metres>(5.0, 1e-6));
+  expectBulkMatchesScalar<Micrometres>(ramp<Metres>(1.23e-4, 1e-6));
+
+  // Boundaries of int32: INT32_MAX itself is not a float, and float rounds up to 2^31.
+  std::vector<Metres> edges(16, Metres(0.0));
+  edges[0] = Metres(2147.4836465);
+  edges[1] = Metres(2147.4836475);
+  edges[2] = Metres(-2147.4836485);
+  edges[3] = Metres(-2147.4836475);
+  expectBulkMatchesScalar<Micrometres>(edges);
+
+  std::vector<MetresFloat> floatEdges(16, MetresFloat(0.0F));
+  floatEdges[0] = MetresFloat(2147.4836F);
+  floatEdges[1] = MetresFloat(-2147.4836F);
+  floatEdges[2] = MetresFloat(2147.483F);
+  expectBulkMatchesScalar<Micrometres>(floatEdges);
+}
+
+} // End of namespace units.
\ No newline at end of file
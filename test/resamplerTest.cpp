@@ -0,0 +1,159 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <units/resampler.hpp>
+#include <units/si.hpp>
+#include <vector>
+
+namespace units
+{
+
+using Milliseconds = AffineQuantity<PhysicalUnits<Time, std::milli>, double>;
+
+/// Sink collecting every point it receives and the sizes of the chunks.
+struct CollectingSink
+{
+  std::vector<double> times;
+  std::vector<double> values;
+  std::vector<std::size_t> chunks;
+
+  void operator()(const Seconds* const time, const Metres* const value, const std::size_t size)
+  {
+    for(std::size_t index = 0; index < size; ++index)
+    {
+      times.push_back(time[index].scalar());
+      values.push_back(value[index].scalar());
+    }
+
+    chunks.push_back(size);
+  }
+};
+
+TEST(Resampler, ZeroOrderHoldAcrossTimeUnits)
+{
+  Resampler<Seconds, Metres, ZeroOrderHold> resampler(Seconds(0.0), Seconds(0.1));
+  CollectingSink sink;
+
+  // Samples every 150 ms: 0, 150, 300, 450 ms with values 0, 1, 2, 3.
+  const std::vector<Milliseconds> stamps{
+    Milliseconds(0.0), Milliseconds(150.0), Milliseconds(300.0)
+  };
+  const std::vector<Metres> values{ Metres(0.0), Metres(1.0), Metres(2.0) };
+  resampler.push(stamps.data(), values.data(), stamps.size(), sink);
+
+  // The next batch arrives in seconds.
+  const std::vector<Seconds> moreStamps{ Seconds(0.45) };
+  const std::vector<Metres> moreValues{ Metres(3.0) };
+  resampler.push(moreStamps.data(), moreValues.data(), moreStamps.size(), sink);
+  resampler.flush(sink);
+
+  // Grid points 0, 100, 200, 300 and 400 ms precede the last sample.
+  ASSERT_EQ(5U, sink.times.size());
+  EXPECT_DOUBLE_EQ(0.0, sink.times[0]);
+  EXPECT_DOUBLE_EQ(0.4, sink.times[4]);
+  EXPECT_EQ((std::vector<double>{ 0.0, 0.0, 1.0, 2.0, 2.0 }), sink.values);
+}
+
+TEST(Resampler, LinearInterpolationReproducesLines)
+{
+  Resampler<Seconds, Metres, LinearInterpolation> resampler(Seconds(1.0), Seconds(0.25));
+  CollectingSink sink;
+
+  std::vector<Milliseconds> stamps;
+  std::vector<Metres> values;
+  for(int index = 0; index <= 30; ++index)
+  {
+    stamps.emplace_back(70.0 * index + 3.0);
+    values.emplace_back(2.0 * (0.07 * index + 0.003) - 1.0);
+  }
+
+  resampler.push(stamps.data(), values.data(), stamps.size(), sink);
+  resampler.flush(sink);
+
+  // Grid points 1.0, 1.25, ..., 2.0 lie within the 0.003 .. 2.103 s span of the samples.
+  ASSERT_EQ(5U, sink.times.size());
+  for(std::size_t index = 0; index < sink.times.size(); ++index)
+  {
+    EXPECT_DOUBLE_EQ(1.0 + 0.25 * double(index), sink.times[index]);
+    EXPECT_NEAR(2.0 * sink.times[index] - 1.0, sink.values[index], 1e-12);
+  }
+}
+
+TEST(Resampler, DecimationSuppressesAliases)
+{
+  Resampler<Seconds, Metres, Decimation> resampler(Seconds(0.0), Seconds(0.1));
+  CollectingSink sink;
+
+  // 1 kHz input: a 5 m offset plus a tone at the input Nyquist rate, which naive picking of every
+  // 100th sample would alias onto the offset.
+  std::vector<Seconds> stamps;
+  std::vector<Metres> values;
+  for(int index = 1; index <= 1000; ++index)
+  {
+    stamps.emplace_back(0.001 * index);
+    values.emplace_back(5.0 + (index % 2 == 0 ? 1.0 : -1.0));
+  }
+
+  resampler.push(stamps.data(), values.data(), stamps.size(), sink);
+  resampler.push(stamps.data(), values.data(), 0U, sink);
+
+  const Seconds last(1.05);
+  const Metres lastValue(5.0);
+  resampler.push(&last, &lastValue, 1U, sink);
+  resampler.flush(sink);
+
+  ASSERT_EQ(10U, sink.values.size());
+  for(std::size_t index = 0; index < sink.values.size(); ++index)
+  {
+    EXPECT_NEAR(0.1 * double(index + 1U), sink.times[index], 1e-12);
+    EXPECT_NEAR(5.0, sink.values[index], 1e-9);
+  }
+}
+
+TEST(Resampler, EmitsBoundedChunks)
+{
+  Resampler<Seconds, Metres, ZeroOrderHold, 4U> resampler(Seconds(0.0), Seconds(1.0));
+  CollectingSink sink;
+
+  std::vector<Seconds> stamps;
+  std::vector<Metres> values;
+  for(int index = 0; index <= 10; ++index)
+  {
+    stamps.emplace_back(double(index));
+    values.emplace_back(double(index));
+  }
+
+  resampler.push(stamps.data(), values.data(), stamps.size(), sink);
+  EXPECT_EQ((std::vector<std::size_t>{ 4U, 4U }), sink.chunks);
+
+  resampler.flush(sink);
+  EXPECT_EQ((std::vector<std::size_t>{ 4U, 4U, 2U }), sink.chunks);
+  EXPECT_EQ(10U, sink.values.size());
+  EXPECT_DOUBLE_EQ(9.0, sink.values.back());
+
+  resampler.flush(sink);
+  EXPECT_EQ(3U, sink.chunks.size());
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+
+namespace units
+{
+
+TEST(MultiplyScales, StaticChecks)
+{
+  static_assert(
+      std::is_same<std::ratio<3, 40>, typename MultiplyScales<std::ratio<1, 4>, std::ratio<3, 10>>::
+                                          Result>::value,
+      "Representable products are required to remain std::ratio in @class MultiplyScales");
+
+  using Overflowing =
+      typename MultiplyScales<std::ratio<1, 10000000000>, std::ratio<1, 10000000000>>::Result;
+
+  static_assert(
+      std::is_same<FactoredScale<PrimePower<2, -20>, PrimePower<5, -20>>, Overflowing>::value,
+      "Overflowing products are required to be factored in @class MultiplyScales");
+
+  static_assert(
+      std::is_same<
+          std::ratio<1, 10000000000>,
+          typename DivideScales<Overflowing, std::ratio<1, 10000000000>>::Result>::value,
+      "Representable quotients are required to collapse back into std::ratio in @class "
+      "DivideScales");
+}
+
+TEST(ScaleValue, StaticChecks)
+{
+  static_assert(
+      ScaleValue<std::ratio<1, 12>, double>::kValue == 1.0 / 12.0,
+      "kValue is incorrectly computed for std::ratio in @class ScaleValue");
+
+  static_assert(
+      ScaleValue<FactoredScale<PrimePower<2, -3>, PrimePower<5, -4>, PrimePower<127, 1>>, double>::
+              kValue == 0.0254,
+      "kValue is incorrectly computed for FactoredScale in @class ScaleValue");
+
+  // 2^130 overflows float although 2^130 / 3^80 is about 9.2.
+  using WideScale = FactoredScale<PrimePower<2, 130>, PrimePower<3, -80>>;
+
+  static_assert(
+      ScaleValue<WideScale, float>::kValue ==
+          static_cast<float>(ScaleValue<WideScale, long double>::kValue),
+      "kValue is required to be rounded to FloatType only once in @class ScaleValue");
+}
+
+TEST(FactoredScale, LongImperialChain)
+{
+  // The scale of pound²·foot/inch overflows std::intmax_t if chained as std::ratio.
+  const auto q = Pounds(2.0) * Pounds(3.0) * Feet(4.0) / Inches(8.0);
+
+  using Units = typename decltype(q)::PhysicalUnits;
+
+  static_assert(
+      std::is_same<
+          typename MultiplyPhysicalDimensions<Mass, Mass>::Result,
+          typename Units::PhysicalDimensions>::value,
+      "Physical dimensions are incorrectly computed for a long imperial chain");
+
+  EXPECT_DOUBLE_EQ(3.0, q.scalar());
+
+  using SIUnits = PhysicalUnits<typename Units::PhysicalDimensions, std::ratio<1>>;
+  const AffineQuantity<SIUnits, double> si(q);
+
+  EXPECT_DOUBLE_EQ(3.0 * 0.45359237 * 0.45359237 * 0.3048 / 0.0254, si.scalar());
+
+  const Pounds p = q / Pounds(1.0) / Feet(1.0) * Inches(1.0);
+  EXPECT_DOUBLE_EQ(3.0, p.scalar());
+}
+
+} // End of namespace units.
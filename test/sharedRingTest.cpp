@@ -0,0 +1,221 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+
+#if defined(__unix__) or defined(__APPLE__)
+
+#include <sched.h>
+#include <stdexcept>
+#include <string>
+#include <sys/wait.h>
+#include <units/imperial.hpp>
+#include <units/sharedRing.hpp>
+#include <units/si.hpp>
+#include <unistd.h>
+#include <vector>
+
+namespace units
+{
+
+std::string uniqueRingName(const char* const test)
+{
+  return "/unitsTest." + std::string(test) + "." + std::to_string(::getpid());
+}
+
+TEST(SharedRing, RejectsConsumersOfADifferentQuantity)
+{
+  const auto name = uniqueRingName("Reject");
+  SharedRingProducer<Metres> producer(name, 16U);
+
+  EXPECT_THROW(SharedRingConsumer<Feet> feet(name), std::runtime_error);
+  EXPECT_THROW(SharedRingConsumer<Seconds> seconds(name), std::runtime_error);
+  EXPECT_THROW(
+      (SharedRingConsumer<AffineQuantity<MetresPhysicalUnit, float>>(name)),
+      std::runtime_error);
+  EXPECT_THROW(SharedRingConsumer<Metres> missing(name + ".missing"), std::runtime_error);
+  EXPECT_THROW(SharedRingProducer<Metres> duplicate(name, 16U), std::runtime_error);
+
+  EXPECT_NO_THROW(SharedRingConsumer<Metres> metres(name));
+  EXPECT_NO_THROW(SharedRingConsumer<ExplicitQuantity<Metres>> explicitMetres(name));
+}
+
+TEST(SharedRing, HandsOutZeroCopySpansAcrossTheWrap)
+{
+  const auto name = uniqueRingName("Wrap");
+  SharedRingProducer<Feet> producer(name, 6U);
+  SharedRingConsumer<Feet> consumer(name);
+
+  EXPECT_EQ(8U, producer.capacity());
+  EXPECT_TRUE(consumer.peek().empty());
+
+  const std::vector<Feet> first{ Feet(1.0), Feet(2.0), Feet(3.0), Feet(4.0), Feet(5.0), Feet(6.0) };
+  EXPECT_EQ(6U, producer.write(first.data(), first.size()));
+
+  const auto span = consumer.peek();
+  ASSERT_EQ(6U, span.size());
+  EXPECT_EQ(span.data(), &span[0]);
+  EXPECT_DOUBLE_EQ(6.0, span[5].scalar());
+  consumer.release(5U);
+
+  const std::vector<Feet> second{ Feet(7.0), Feet(8.0), Feet(9.0), Feet(10.0) };
+  EXPECT_EQ(4U, producer.write(second.data(), second.size()));
+
+  const auto beforeWrap = consumer.peek();
+  ASSERT_EQ(3U, beforeWrap.size());
+  EXPECT_DOUBLE_EQ(6.0, beforeWrap[0].scalar());
+  EXPECT_DOUBLE_EQ(8.0, beforeWrap[2].scalar());
+  consumer.release(beforeWrap.size());
+
+  const auto afterWrap = consumer.peek();
+  ASSERT_EQ(2U, afterWrap.size());
+  EXPECT_DOUBLE_EQ(9.0, afterWrap[0].scalar());
+  EXPECT_DOUBLE_EQ(10.0, afterWrap[1].scalar());
+}
+
+TEST(SharedRing, ProducerWaitsForTheSlowestConsumer)
+{
+  const auto name = uniqueRingName("Backpressure");
+  SharedRingProducer<Metres> producer(name, 4U);
+  SharedRingConsumer<Metres> fast(name);
+  SharedRingConsumer<Metres> slow(name);
+
+  const std::vector<Metres> samples(6U, Metres(1.0));
+  EXPECT_EQ(4U, producer.write(samples.data(), samples.size()));
+
+  fast.release(fast.peek().size());
+  EXPECT_EQ(0U, producer.write(samples.data(), samples.size()));
+
+  slow.release(2U);
+  EXPECT_EQ(2U, producer.write(samples.data(), samples.size()));
+  EXPECT_EQ(2U, fast.peek().size());
+}
+
+TEST(SharedRing, ReusesASlotAfterMoreThanCapacityWrites)
+{
+  const auto name = uniqueRingName("Reuse");
+  SharedRingProducer<Metres> producer(name, 8U);
+  std::vector<Metres> samples(8U);
+
+  {
+    SharedRingConsumer<Metres> first(name);
+    EXPECT_EQ(8U, producer.write(samples.data(), samples.size()));
+    first.release(first.peek().size());
+  }
+
+  for(int round = 0; round < 5; ++round)
+  {
+    EXPECT_EQ(8U, producer.write(samples.data(), samples.size()));
+  }
+
+  SharedRingConsumer<Metres> second(name);
+  EXPECT_TRUE(second.peek().empty());
+
+  for(std::size_t index = 0; index < samples.size(); ++index)
+  {
+    samples[index] = Metres(static_cast<double>(index));
+  }
+
+  const std::vector<Metres> more(16U, Metres(-1.0));
+  EXPECT_EQ(8U, producer.write(more.data(), more.size()));
+  EXPECT_EQ(0U, producer.write(samples.data(), samples.size()));
+
+  const auto span = second.peek();
+  ASSERT_EQ(8U, span.size());
+  EXPECT_DOUBLE_EQ(-1.0, span[7].scalar());
+  second.release(span.size());
+
+  EXPECT_EQ(8U, producer.write(samples.data(), samples.size()));
+  EXPECT_DOUBLE_EQ(7.0, second.peek()[7].scalar());
+}
+
+TEST(SharedRing, StreamsBetweenProcesses)
+{
+  const auto name = uniqueRingName("Processes");
+  constexpr int kSamples = 10000;
+
+  SharedRingProducer<Seconds> producer(name, 64U);
+
+  int attached[2];
+  ASSERT_EQ(0, ::pipe(attached));
+
+  const pid_t child = ::fork();
+  ASSERT_GE(child, 0);
+
+  if(child == 0)
+  {
+    SharedRingConsumer<Seconds> consumer(name);
+    const char signal = 1;
+    bool ordered = ::write(attached[1], &signal, 1) == 1;
+
+    for(int expected = 0; expected < kSamples;)
+    {
+      const auto span = consumer.peek();
+
+      for(const auto sample: span)
+      {
+        ordered = ordered and sample.scalar() == static_cast<double>(expected++);
+      }
+
+      consumer.release(span.size());
+
+      if(span.empty())
+      {
+        ::sched_yield();
+      }
+    }
+
+    ::_exit(ordered ? 0 : 1);
+  }
+
+  char signal = 0;
+  ASSERT_EQ(1, ::read(attached[0], &signal, 1));
+  ::close(attached[0]);
+  ::close(attached[1]);
+
+  std::vector<Seconds> samples(kSamples);
+  for(int index = 0; index < kSamples; ++index)
+  {
+    samples[index] = Seconds(static_cast<double>(index));
+  }
+
+  for(std::size_t written = 0; written < samples.size();)
+  {
+    const std::size_t count = producer.write(samples.data() + written, samples.size() - written);
+    written += count;
+
+    if(count == 0U)
+    {
+      ::sched_yield();
+    }
+  }
+
+  int status = 0;
+  ASSERT_EQ(child, ::waitpid(child, &status, 0));
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+}
+
+} // End of namespace units.
+
+#endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+
+#if defined(__has_include)
+#if __has_include(<experimental/simd>) and __cplusplus >= 201703L
+#define UNITS_TEST_EXPERIMENTAL_SIMD
+#include <experimental/simd>
+#endif
+#endif
+
+#if defined(UNITS_TEST_EXPERIMENTAL_SIMD)
+
+namespace units
+{
+
+namespace stdx = std::experimental;
+
+using DoubleLanes = stdx::native_simd<double>;
+using MetresLanes = AffineQuantity<MetresPhysicalUnit, DoubleLanes>;
+using InchesLanes = AffineQuantity<InchesPhysicalUnit, DoubleLanes>;
+using SecondsLanes = AffineQuantity<SecondsPhysicalUnit, DoubleLanes>;
+
+DoubleLanes iota(const double offset)
+{
+  return DoubleLanes([offset](const auto lane) { return offset + static_cast<double>(lane); });
+}
+
+TEST(SimdAffineQuantity, StaticChecks)
+{
+  static_assert(
+      std::is_same<double, typename RepresentationTraits<DoubleLanes>::Scalar>::value,
+      "Scalar is incorrectly deduced for SIMD representations in @class RepresentationTraits");
+
+  static_assert(
+      std::is_same<
+          double,
+          std::decay_t<decltype(PhysicalUnitsScale<
+                                MetresPhysicalUnit,
+                                InchesPhysicalUnit,
+                                DoubleLanes>::kScale)>>::value,
+      "kScale is required to be a scalar for SIMD representations in @class PhysicalUnitsScale");
+}
+
+TEST(SimdAffineQuantity, ConvertConstruction)
+{
+  const MetresLanes m(InchesLanes(iota(1.0)));
+
+  for(std::size_t lane = 0; lane < DoubleLanes::size(); ++lane)
+  {
+    EXPECT_DOUBLE_EQ((1.0 + static_cast<double>(lane)) * 0.0254, m.scalar()[lane]);
+  }
+}
+
+TEST(SimdAffineQuantity, Arithmetic)
+{
+  const MetresLanes m(iota(1.0));
+  const SecondsLanes s(DoubleLanes(2.0));
+
+  const auto sum = m + InchesLanes(DoubleLanes(100.0));
+  const auto speed = m / s;
+  const auto area = multiply<CanonicalScalePolicy>(m, InchesLanes(DoubleLanes(10.0)));
+
+  for(std::size_t lane = 0; lane < DoubleLanes::size(); ++lane)
+  {
+    const auto value = 1.0 + static_cast<double>(lane);
+    EXPECT_DOUBLE_EQ(value + 2.54, sum.scalar()[lane]);
+    EXPECT_DOUBLE_EQ(value / 2.0, speed.scalar()[lane]);
+    EXPECT_DOUBLE_EQ(value * 0.254, area.scalar()[lane]);
+  }
+}
+
+TEST(SimdAffineQuantity, ComparisonsReturnMasks)
+{
+  const MetresLanes m(iota(0.0));
+  const InchesLanes threshold(DoubleLanes(1.5 / 0.0254));
+
+  const auto less = m < threshold;
+  const auto notEqual = m != MetresLanes(DoubleLanes(1.0));
+
+  static_assert(
+      std::is_same<typename DoubleLanes::mask_type, std::decay_t<decltype(less)>>::value,
+      "Comparisons of SIMD quantities are required to return lane masks");
+
+  for(std::size_t lane = 0; lane < DoubleLanes::size(); ++lane)
+  {
+    EXPECT_EQ(static_cast<double>(lane) < 1.5, static_cast<bool>(less[lane]));
+    EXPECT_EQ(lane != 1, static_cast<bool>(notEqual[lane]));
+  }
+}
+
+} // End of namespace units.
+
+#endif
@@ -0,0 +1,213 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <units/imperial.hpp>
+#include <units/si.hpp>
+#include <units/statistics.hpp>
+#include <vector>
+
+namespace units
+{
+
+/// Deterministic, moderately rough test signal.
+double signal(const std::size_t index, const std::size_t channel = 0U)
+{
+  return 10.0 * std::sin(0.37 * double(index) + double(channel)) + double((index * 7U) % 5U);
+}
+
+TEST(Statistics, VarianceIsTypedInSquaredUnits)
+{
+  using Area = MultiplyPhysicalUnits<FeetPhysicalUnit, FeetPhysicalUnit, PreserveScalePolicy>;
+
+  EXPECT_TRUE((std::is_same<
+               AffineQuantity<Area::Result, double>,
+               RollingStatistics<Feet, 4>::Variance>::value));
+
+  EXPECT_TRUE((std::is_same<
+               decltype(std::declval<ExponentialMovingAverage<Feet>>().standardDeviation()),
+               Feet>::value));
+}
+
+TEST(Statistics, ExponentialMovingAverage)
+{
+  ExponentialMovingAverage<Metres> average(0.25);
+  double mean = 0.0;
+  double variance = 0.0;
+
+  for(std::size_t index = 0; index < 200U; ++index)
+  {
+    const double sample = signal(index);
+    average.update(Metres(sample));
+
+    if(index == 0U)
+    {
+      mean = sample;
+      continue;
+    }
+
+    const double delta = sample - mean;
+    mean += 0.25 * delta;
+    variance = 0.75 * (variance + 0.25 * delta * delta);
+  }
+
+  EXPECT_EQ(200U, average.count());
+  EXPECT_NEAR(mean, average.mean().scalar(), 1e-12);
+  EXPECT_NEAR(variance, average.variance().scalar(), 1e-12);
+  EXPECT_NEAR(std::sqrt(variance), average.standardDeviation().scalar(), 1e-12);
+}
+
+TEST(Statistics, RollingMeanAndVarianceMatchTheWindow)
+{
+  constexpr std::size_t kWindow = 16U;
+  RollingStatistics<Seconds, kWindow> statistics;
+  std::deque<double> window;
+
+  for(std::size_t index = 0; index < 500U; ++index)
+  {
+    statistics.update(Seconds(signal(index)));
+    window.push_back(signal(index));
+
+    if(window.size() > kWindow)
+    {
+      window.pop_front();
+    }
+
+    double mean = 0.0;
+    for(const double sample: window)
+    {
+      mean += sample;
+    }
+    mean /= double(window.size());
+
+    double squares = 0.0;
+    for(const double sample: window)
+    {
+      squares += (sample - mean) * (sample - mean);
+    }
+
+    const double variance = window.size() < 2U ? 0.0 : squares / double(window.size() - 1U);
+
+    ASSERT_EQ(window.size(), statistics.size());
+    ASSERT_NEAR(mean, statistics.mean().scalar(), 1e-9) << index;
+    ASSERT_NEAR(variance, statistics.variance().scalar(), 1e-9) << index;
+    ASSERT_NEAR(std::sqrt(variance), statistics.standardDeviation().scalar(), 1e-9) << index;
+  }
+}
+
+TEST(Statistics, RollingMinimumAndMaximumMatchTheWindow)
+{
+  constexpr std::size_t kWindow = 7U;
+  RollingMinimum<Metres, kWindow> minimum;
+  RollingMaximum<Metres, kWindow> maximum;
+  std::deque<double> window;
+
+  for(std::size_t index = 0; index < 300U; ++index)
+  {
+    // Quantise to provoke ties.
+    const double sample = std::round(signal(index));
+    minimum.update(Metres(sample));
+    maximum.update(Metres(sample));
+    window.push_back(sample);
+
+    if(window.size() > kWindow)
+    {
+      window.pop_front();
+    }
+
+    ASSERT_EQ(*std::min_element(window.begin(), window.end()), minimum.value().scalar()) << index;
+    ASSERT_EQ(*std::max_element(window.begin(), window.end()), maximum.value().scalar()) << index;
+  }
+}
+
+template<typename FloatType>
+void checkMultiChannel(const double tolerance)
+{
+  using Quantity = AffineQuantity<MetresPhysicalUnit, FloatType>;
+  constexpr std::size_t kChannels = 37U;
+  constexpr std::size_t kWindow = 9U;
+
+  MultiChannelExponentialMovingAverage<Quantity, kChannels> averages(FloatType(0.125));
+  MultiChannelRollingStatistics<Quantity, kChannels, kWindow> statistics;
+  MultiChannelRollingMinimum<Quantity, kChannels, kWindow> minima;
+  MultiChannelRollingMaximum<Quantity, kChannels, kWindow> maxima;
+
+  std::vector<ExponentialMovingAverage<Quantity>> referenceAverages(
+      kChannels, ExponentialMovingAverage<Quantity>(FloatType(0.125)));
+  std::vector<RollingStatistics<Quantity, kWindow>> referenceStatistics(kChannels);
+  std::vector<RollingMinimum<Quantity, kWindow>> referenceMinima(kChannels);
+  std::vector<RollingMaximum<Quantity, kWindow>> referenceMaxima(kChannels);
+
+  std::vector<Quantity> frame(kChannels);
+
+  for(std::size_t index = 0; index < 100U; ++index)
+  {
+    for(std::size_t channel = 0; channel < kChannels; ++channel)
+    {
+      frame[channel] = Quantity(FloatType(signal(index, channel)));
+      referenceAverages[channel].update(frame[channel]);
+      referenceStatistics[channel].update(frame[channel]);
+      referenceMinima[channel].update(frame[channel]);
+      referenceMaxima[channel].update(frame[channel]);
+    }
+
+    averages.update(frame.data());
+    statistics.update(frame.data());
+    minima.update(frame.data());
+    maxima.update(frame.data());
+
+    for(std::size_t channel = 0; channel < kChannels; ++channel)
+    {
+      ASSERT_NEAR(
+          referenceAverages[channel].mean().scalar(),
+          averages.mean(channel).scalar(),
+          tolerance);
+      ASSERT_NEAR(
+          referenceAverages[channel].variance().scalar(),
+          averages.variance(channel).scalar(),
+          tolerance);
+      ASSERT_NEAR(
+          referenceStatistics[channel].mean().scalar(),
+          statistics.mean(channel).scalar(),
+          tolerance);
+      ASSERT_NEAR(
+          referenceStatistics[channel].variance().scalar(),
+          statistics.variance(channel).scalar(),
+          tolerance);
+      ASSERT_EQ(referenceMinima[channel].value().scalar(), minima.value(channel).scalar());
+      ASSERT_EQ(referenceMaxima[channel].value().scalar(), maxima.value(channel).scalar());
+    }
+  }
+}
+
+TEST(Statistics, MultiChannelMatchesSingleChannel)
+{
+  checkMultiChannel<double>(1e-9);
+  checkMultiChannel<float>(1e-3);
+}
+
+} // End of namespace units.
\ No newline at end of file
@@ -0,0 +1,111 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2018 Anurag Jakhotia
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <units/imperial.hpp>
+#include <units/prefixes.hpp>
+#include <units/si.hpp>
+#include <units/unitExpression.hpp>
+
+namespace units
+{
+
+using Newtons = DividePhysicalUnits<
+    MultiplyPhysicalUnits<KilogramsPhysicalUnit, MetresPhysicalUnit, PreserveScalePolicy>::Result,
+    MultiplyPhysicalUnits<SecondsPhysicalUnit, SecondsPhysicalUnit, PreserveScalePolicy>::Result,
+    PreserveScalePolicy>::Result;
+
+using FeetPerSecond =
+    DividePhysicalUnits<FeetPhysicalUnit, SecondsPhysicalUnit, PreserveScalePolicy>::Result;
+
+TEST(UnitExpression, ResolvesToTheComposedPhysicalUnits)
+{
+  EXPECT_TRUE((std::is_same_v<MetresPhysicalUnit, Unit<"m">>));
+  EXPECT_TRUE((std::is_same_v<Newtons, Unit<"kg*m/s^2">>));
+  EXPECT_TRUE((std::is_same_v<Newtons, Unit<"kg * m / s / s">>));
+  EXPECT_TRUE((std::is_same_v<Newtons, Unit<"m*kg*s^-2">>));
+  EXPECT_TRUE((std::is_same_v<FeetPerSecond, Unit<"ft/s">>));
+  EXPECT_TRUE((std::is_same_v<RadiansPhysicalUnit, Unit<"rad">>));
+  EXPECT_TRUE((std::is_same_v<RadiansPhysicalUnit, Unit<"m/m">>));
+}
+
+TEST(UnitExpression, ReducesScales)
+{
+  EXPECT_TRUE((std::is_same_v<std::ratio<381, 1250>, Unit<"ft">::Scale>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<1, 1000>, Unit<"g">::Scale>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<1, 3600>, Unit<"1/h">::Scale>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<1, 1>, Unit<"in/in">::Scale>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<16129, 25000000>, Unit<"in^2">::Scale>));
+}
+
+TEST(UnitExpression, SupportsRationalExponents)
+{
+  using RootMetres = Unit<"m^(1/2)">;
+
+  EXPECT_TRUE((std::is_same_v<std::ratio<1, 2>, RootMetres::PhysicalDimensions::L>));
+  EXPECT_TRUE((std::is_same_v<MetresPhysicalUnit, Unit<"m^(1/2)*m^(1/2)">>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<-3, 2>, Unit<"s^(-3/2)">::PhysicalDimensions::T>));
+}
+
+TEST(UnitExpression, ParsesPrefixes)
+{
+  EXPECT_TRUE((std::is_same_v<KilometresPhysicalUnit, Unit<"km">>));
+  EXPECT_TRUE((std::is_same_v<MillisecondsPhysicalUnit, Unit<"ms">>));
+  EXPECT_TRUE((std::is_same_v<MicrogramsPhysicalUnit, Unit<"ug">>));
+  EXPECT_TRUE((std::is_same_v<DecametresPhysicalUnit, Unit<"dam">>));
+  EXPECT_TRUE((std::is_same_v<MilliradiansPhysicalUnit, Unit<"mrad">>));
+  EXPECT_TRUE((std::is_same_v<KilomolesPhysicalUnit, Unit<"kmol">>));
+  EXPECT_TRUE((std::is_same_v<KilogramsPhysicalUnit, Unit<"kg">>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<60>, Unit<"min">::Scale>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<1, 1000>, Unit<"mm/m">::Scale>));
+  EXPECT_DOUBLE_EQ(3.6, (Quantity<"km/h">(Quantity<"m/s">(1.0))).scalar());
+}
+
+TEST(UnitExpression, FallsBackToFactoredScales)
+{
+  using InchesSquared = MultiplyScales<InchesPhysicalUnit::Scale, InchesPhysicalUnit::Scale>;
+  using InchesToTheFourth = MultiplyScales<InchesSquared::Result, InchesSquared::Result>;
+  using InchesToTheEighth =
+      MultiplyScales<InchesToTheFourth::Result, InchesToTheFourth::Result>::Result;
+
+  EXPECT_TRUE((std::is_same_v<InchesToTheEighth, Unit<"in^8">::Scale>));
+  EXPECT_TRUE((std::is_same_v<QuettametresPhysicalUnit, Unit<"Qm">>));
+  EXPECT_TRUE(
+      (std::is_same_v<FactoredScale<PrimePower<2, 21>, PrimePower<5, 21>>, Unit<"km^7">::Scale>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<1000>, Unit<"km^7/Mm^3">::Scale>));
+  EXPECT_TRUE((std::is_same_v<RadiansPhysicalUnit, Unit<"Qm*qm/m^2">>));
+  EXPECT_TRUE((std::is_same_v<std::ratio<10>, Unit<"hm^(1/2)">::Scale>));
+}
+
+TEST(UnitExpression, DeclaresQuantities)
+{
+  constexpr Quantity<"m/s^2"> gravity(9.81);
+  const auto force = Kilograms(2.0) * gravity;
+
+  EXPECT_TRUE((std::is_same_v<Quantity<"kg*m/s^2">, std::decay_t<decltype(force)>>));
+  EXPECT_DOUBLE_EQ(19.62, force.scalar());
+  EXPECT_FLOAT_EQ(0.3048F, (Quantity<"m", float>(Quantity<"ft", float>(1.0F))).scalar());
+}
+
+} // End of namespace units.
\ No newline at end of file